@@ -743,6 +743,7 @@
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/timer_uv.cc',
         'src/core/lib/iomgr/udp_server.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
@@ -1256,6 +1257,7 @@
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/timer_uv.cc',
         'src/core/lib/iomgr/udp_server.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
@@ -225,6 +225,29 @@ typedef struct {
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** If non-zero, runs of small frames (and small slices of message payload)
+    produced during a single write cycle are copied into a few larger slices
+    before being handed to the endpoint. This reduces the number of iovecs per
+    sendmsg and the per-slice refcounting done by the endpoint when many
+    streams are multiplexed on one connection. Defaults to off (0). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING "grpc.http2.write_coalescing"
+/** Maximum number of DATA bytes a single stream may have framed each time
+    the write scheduler visits it. Streams with more data pending are moved to
+    the back of the writable list, so a bulk streaming call cannot take the
+    whole connection window ahead of other calls on the same transport (byte
+    based round robin). Defaults to 0, meaning a stream may send all it is
+    allowed to by flow control in one visit. */
+#define GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES "grpc.http2.write_quantum_bytes"
+/** If non-zero, a write initiated while the transport is idle is corked until
+    the current execution context has finished all of its other work, so that
+    operations from several batches started on the same call stack leave in a
+    single endpoint write. Defaults to off (0). */
+#define GRPC_ARG_HTTP2_CORK_WRITES "grpc.http2.cork_writes"
+/** Should the HPACK encoder remember the last header block that was encoded
+    purely from table indices and re-emit its bytes when the same metadata is
+    sent again? Defaults to off (0). */
+#define GRPC_ARG_HTTP2_HPACK_CACHE_HEADER_BLOCKS \
+  "grpc.http2.hpack_cache_header_blocks"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -286,6 +309,12 @@ typedef struct {
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** If non-zero, and a SO_REUSEPORT listener is cloned for each of the server's
+    pollsets, tag clone i with SO_INCOMING_CPU i (modulo the number of cores)
+    so the kernel hands each connection to the listener of the CPU that
+    received it. Threads polling a pollset can then be pinned to the
+    matching core. Linux only. Defaults to off (0). */
+#define GRPC_ARG_STEER_INCOMING_CPU "grpc.so_incoming_cpu"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -300,6 +329,13 @@ typedef struct {
   "grpc.service_config_disable_resolution"
 /** LB policy name. */
 #define GRPC_ARG_LB_POLICY_NAME "grpc.lb_policy_name"
+/** If positive, the pick_first LB policy does not wait for a connection
+    attempt to fail before trying the next address: once an attempt has been
+    pending for this many milliseconds, it starts the next one in parallel and
+    keeps whichever connects first (as in RFC 8305, "Happy Eyeballs").
+    Defaults to 0, which tries addresses one at a time. */
+#define GRPC_ARG_PICK_FIRST_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.pick_first_connection_attempt_delay_ms"
 /** The grpc_socket_mutator instance that set the socket options. A pointer. */
 #define GRPC_ARG_SOCKET_MUTATOR "grpc.socket_mutator"
 /** The grpc_socket_factory instance to create and bind sockets. A pointer. */
@@ -343,6 +379,14 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP TX Zerocopy auto-tuning: if non-zero, each endpoint adjusts its send
+   threshold at runtime, starting from
+   GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD. The threshold is raised while
+   zerocopy sends keep falling back to copies (the kernel copied the data, or
+   all GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS sends were still awaiting
+   completion) and lowered again once they stop. By default, it is disabled. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_AUTO_TUNE \
+  "grpc.experimental.tcp_tx_zerocopy_auto_tune"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -974,6 +974,10 @@ class ChannelData::SubchannelWrapper : public SubchannelInterface {
 
   void ResetBackoff() override { subchannel_->ResetBackoff(); }
 
+  bool GetConnectionEstimates(ConnectionEstimates* estimates) override {
+    return subchannel_->GetConnectionEstimates(estimates);
+  }
+
   void ThrottleKeepaliveTime(int new_keepalive_time) {
     subchannel_->ThrottleKeepaliveTime(new_keepalive_time);
   }
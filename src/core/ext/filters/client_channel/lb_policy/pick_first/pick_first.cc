@@ -18,6 +18,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <limits.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
@@ -29,6 +30,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/sockaddr_utils.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
 
@@ -92,6 +94,9 @@ class PickFirst : public LoadBalancingPolicy {
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
       policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+      GRPC_CLOSURE_INIT(&on_connection_attempt_timer_,
+                        &PickFirstSubchannelList::OnConnectionAttemptTimer,
+                        this, grpc_schedule_on_exec_ctx);
     }
 
     ~PickFirstSubchannelList() {
@@ -99,13 +104,47 @@ class PickFirst : public LoadBalancingPolicy {
       p->Unref(DEBUG_LOCATION, "subchannel_list");
     }
 
+    void Orphan() override {
+      if (connection_attempt_timer_pending_) {
+        grpc_timer_cancel(&connection_attempt_timer_);
+      }
+      SubchannelList::Orphan();
+    }
+
     bool in_transient_failure() const { return in_transient_failure_; }
     void set_in_transient_failure(bool in_transient_failure) {
       in_transient_failure_ = in_transient_failure;
     }
 
+    // Connection attempts are made in passes over the list, in order. This
+    // is the index of the next subchannel to try in the current pass.
+    size_t attempt_cursor() const { return attempt_cursor_; }
+    void set_attempt_cursor(size_t attempt_cursor) {
+      attempt_cursor_ = attempt_cursor;
+    }
+
+    // Returns true if any subchannel in the list is still being watched,
+    // i.e. has a connection attempt in flight.
+    bool AnyConnectionAttemptPendingLocked();
+
+    // Starts watching (and connecting) the subchannel at attempt_cursor(),
+    // which must be in range, and advances the cursor.
+    void StartNextConnectionAttemptLocked();
+
+    // If GRPC_ARG_PICK_FIRST_CONNECTION_ATTEMPT_DELAY_MS is set and the
+    // current pass has untried subchannels, arms the timer that starts the
+    // next attempt without waiting for the pending ones to fail.
+    void MaybeStartConnectionAttemptTimerLocked();
+
    private:
+    static void OnConnectionAttemptTimer(void* arg, grpc_error* error);
+    void OnConnectionAttemptTimerLocked(grpc_error* error);
+
     bool in_transient_failure_ = false;
+    size_t attempt_cursor_ = 0;
+    grpc_timer connection_attempt_timer_;
+    grpc_closure on_connection_attempt_timer_;
+    bool connection_attempt_timer_pending_ = false;
   };
 
   class Picker : public SubchannelPicker {
@@ -136,6 +175,8 @@ class PickFirst : public LoadBalancingPolicy {
   OrphanablePtr<PickFirstSubchannelList> latest_pending_subchannel_list_;
   // Selected subchannel in \a subchannel_list_.
   PickFirstSubchannelData* selected_ = nullptr;
+  // Value of GRPC_ARG_PICK_FIRST_CONNECTION_ATTEMPT_DELAY_MS.
+  int connection_attempt_delay_ms_ = 0;
   // Are we in IDLE state?
   bool idle_ = false;
   // Are we shut down?
@@ -233,6 +274,8 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
     // Note: No need to use CheckConnectivityStateAndStartWatchingLocked()
     // here, since we've already checked the initial connectivity
     // state of all subchannels above.
+    subchannel_list_->set_attempt_cursor(1);
+    subchannel_list_->MaybeStartConnectionAttemptTimerLocked();
     subchannel_list_->subchannel(0)->StartConnectivityWatchLocked();
     subchannel_list_->subchannel(0)->subchannel()->AttemptToConnect();
   } else {
@@ -253,6 +296,8 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
     // Note: No need to use CheckConnectivityStateAndStartWatchingLocked()
     // here, since we've already checked the initial connectivity
     // state of all subchannels above.
+    latest_pending_subchannel_list_->set_attempt_cursor(1);
+    latest_pending_subchannel_list_->MaybeStartConnectionAttemptTimerLocked();
     latest_pending_subchannel_list_->subchannel(0)
         ->StartConnectivityWatchLocked();
     latest_pending_subchannel_list_->subchannel(0)
@@ -274,6 +319,9 @@ void PickFirst::UpdateLocked(UpdateArgs args) {
       grpc_channel_args_copy_and_add(args.args, &new_arg, 1);
   GPR_SWAP(const grpc_channel_args*, new_args, args.args);
   grpc_channel_args_destroy(new_args);
+  connection_attempt_delay_ms_ = grpc_channel_args_find_integer(
+      args.args, GRPC_ARG_PICK_FIRST_CONNECTION_ATTEMPT_DELAY_MS,
+      {0, 0, INT_MAX});
   latest_update_args_ = std::move(args);
   // If we are not in idle, start connection attempt immediately.
   // Otherwise, we defer the attempt into ExitIdleLocked().
@@ -378,31 +426,35 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
     }
     case GRPC_CHANNEL_TRANSIENT_FAILURE: {
       CancelConnectivityWatchLocked("connection attempt failed");
-      PickFirstSubchannelData* sd = this;
-      size_t next_index =
-          (sd->Index() + 1) % subchannel_list()->num_subchannels();
-      sd = subchannel_list()->subchannel(next_index);
-      // If we're tried all subchannels, set state to TRANSIENT_FAILURE.
-      if (sd->Index() == 0) {
-        // Re-resolve if this is the most recent subchannel list.
-        if (subchannel_list() == (p->latest_pending_subchannel_list_ != nullptr
-                                      ? p->latest_pending_subchannel_list_.get()
-                                      : p->subchannel_list_.get())) {
-          p->channel_control_helper()->RequestReresolution();
-        }
-        subchannel_list()->set_in_transient_failure(true);
-        // Only report new state in case 1.
-        if (subchannel_list() == p->subchannel_list_.get()) {
-          grpc_error* error = grpc_error_set_int(
-              GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-                  "failed to connect to all addresses"),
-              GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNAVAILABLE);
-          p->channel_control_helper()->UpdateState(
-              GRPC_CHANNEL_TRANSIENT_FAILURE, grpc_error_to_absl_status(error),
-              absl::make_unique<TransientFailurePicker>(error));
-        }
+      PickFirstSubchannelList* list = subchannel_list();
+      // Move on to the next subchannel in this pass, if there is one.
+      if (list->attempt_cursor() < list->num_subchannels()) {
+        list->StartNextConnectionAttemptLocked();
+        break;
       }
-      sd->CheckConnectivityStateAndStartWatchingLocked();
+      // Otherwise, wait for any attempts still in flight to finish.
+      if (list->AnyConnectionAttemptPendingLocked()) break;
+      // We've tried all subchannels, so set state to TRANSIENT_FAILURE and
+      // start a new pass. Re-resolve if this is the most recent subchannel
+      // list.
+      if (subchannel_list() == (p->latest_pending_subchannel_list_ != nullptr
+                                    ? p->latest_pending_subchannel_list_.get()
+                                    : p->subchannel_list_.get())) {
+        p->channel_control_helper()->RequestReresolution();
+      }
+      subchannel_list()->set_in_transient_failure(true);
+      // Only report new state in case 1.
+      if (subchannel_list() == p->subchannel_list_.get()) {
+        grpc_error* error = grpc_error_set_int(
+            GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                "failed to connect to all addresses"),
+            GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNAVAILABLE);
+        p->channel_control_helper()->UpdateState(
+            GRPC_CHANNEL_TRANSIENT_FAILURE, grpc_error_to_absl_status(error),
+            absl::make_unique<TransientFailurePicker>(error));
+      }
+      list->set_attempt_cursor(0);
+      list->StartNextConnectionAttemptLocked();
       break;
     }
     case GRPC_CHANNEL_CONNECTING:
@@ -478,6 +530,68 @@ void PickFirst::PickFirstSubchannelData::
   }
 }
 
+bool PickFirst::PickFirstSubchannelList::AnyConnectionAttemptPendingLocked() {
+  for (size_t i = 0; i < num_subchannels(); ++i) {
+    if (subchannel(i)->connectivity_watch_pending()) return true;
+  }
+  return false;
+}
+
+void PickFirst::PickFirstSubchannelList::StartNextConnectionAttemptLocked() {
+  GPR_ASSERT(attempt_cursor_ < num_subchannels());
+  PickFirstSubchannelData* sd = subchannel(attempt_cursor_++);
+  // Arm the timer first: the subchannel may already be READY, in which case
+  // it is selected (and the rest of the list shut down) right away.
+  MaybeStartConnectionAttemptTimerLocked();
+  sd->CheckConnectivityStateAndStartWatchingLocked();
+}
+
+void PickFirst::PickFirstSubchannelList::
+    MaybeStartConnectionAttemptTimerLocked() {
+  PickFirst* p = static_cast<PickFirst*>(policy());
+  if (p->connection_attempt_delay_ms_ <= 0 ||
+      connection_attempt_timer_pending_ ||
+      attempt_cursor_ >= num_subchannels()) {
+    return;
+  }
+  Ref(DEBUG_LOCATION, "connection_attempt_timer").release();
+  grpc_timer_init(&connection_attempt_timer_,
+                  ExecCtx::Get()->Now() + p->connection_attempt_delay_ms_,
+                  &on_connection_attempt_timer_);
+  connection_attempt_timer_pending_ = true;
+}
+
+void PickFirst::PickFirstSubchannelList::OnConnectionAttemptTimer(
+    void* arg, grpc_error* error) {
+  PickFirstSubchannelList* self = static_cast<PickFirstSubchannelList*>(arg);
+  PickFirst* p = static_cast<PickFirst*>(self->policy());
+  GRPC_ERROR_REF(error);  // ref owned by lambda
+  p->work_serializer()->Run(
+      [self, error]() { self->OnConnectionAttemptTimerLocked(error); },
+      DEBUG_LOCATION);
+}
+
+void PickFirst::PickFirstSubchannelList::OnConnectionAttemptTimerLocked(
+    grpc_error* error) {
+  connection_attempt_timer_pending_ = false;
+  PickFirst* p = static_cast<PickFirst*>(policy());
+  // Nothing to do if the list was dropped or has already selected a
+  // subchannel.
+  if (error == GRPC_ERROR_NONE && !shutting_down() &&
+      (p->selected_ == nullptr || p->selected_->subchannel_list() != this) &&
+      attempt_cursor_ < num_subchannels()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+      gpr_log(GPR_INFO,
+              "Pick First %p subchannel list %p: connection attempt delay "
+              "elapsed, also trying subchannel %" PRIuPTR,
+              p, this, attempt_cursor_);
+    }
+    StartNextConnectionAttemptLocked();
+  }
+  Unref(DEBUG_LOCATION, "connection_attempt_timer");
+  GRPC_ERROR_UNREF(error);
+}
+
 class PickFirstConfig : public LoadBalancingPolicy::Config {
  public:
   const char* name() const override { return kPickFirst; }
@@ -114,6 +114,12 @@ class SubchannelData {
   // Cancels watching the connectivity state of the subchannel.
   void CancelConnectivityWatchLocked(const char* reason);
 
+  // Returns true between StartConnectivityWatchLocked() and
+  // CancelConnectivityWatchLocked().
+  bool connectivity_watch_pending() const {
+    return pending_watcher_ != nullptr;
+  }
+
   // Cancels any pending connectivity watch and unrefs the subchannel.
   void ShutdownLocked();
 
@@ -86,11 +86,13 @@ DebugOnlyTraceFlag grpc_trace_subchannel_refcount(false, "subchannel_refcount");
 
 ConnectedSubchannel::ConnectedSubchannel(
     grpc_channel_stack* channel_stack, const grpc_channel_args* args,
-    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel)
+    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+    RefCountedPtr<channelz::SocketNode> channelz_socket)
     : RefCounted<ConnectedSubchannel>(&grpc_trace_subchannel_refcount),
       channel_stack_(channel_stack),
       args_(grpc_channel_args_copy(args)),
-      channelz_subchannel_(std::move(channelz_subchannel)) {}
+      channelz_subchannel_(std::move(channelz_subchannel)),
+      channelz_socket_(std::move(channelz_socket)) {}
 
 ConnectedSubchannel::~ConnectedSubchannel() {
   grpc_channel_args_destroy(args_);
@@ -906,6 +908,17 @@ void Subchannel::ResetBackoff() {
   }
 }
 
+bool Subchannel::GetConnectionEstimates(
+    SubchannelInterface::ConnectionEstimates* estimates) {
+  MutexLock lock(&mu_);
+  if (connected_subchannel_ == nullptr) return false;
+  channelz::SocketNode* socket = connected_subchannel_->channelz_socket();
+  if (socket == nullptr) return false;
+  estimates->smoothed_rtt_micros = socket->smoothed_rtt_micros();
+  estimates->bdp_bytes = socket->bdp_bytes();
+  return estimates->smoothed_rtt_micros != 0;
+}
+
 grpc_arg Subchannel::CreateSubchannelAddressArg(
     const grpc_resolved_address* addr) {
   return grpc_channel_arg_string_create(
@@ -1122,7 +1135,7 @@ bool Subchannel::PublishTransportLocked() {
   }
   // Publish.
   connected_subchannel_.reset(
-      new ConnectedSubchannel(stk, args_, channelz_node_));
+      new ConnectedSubchannel(stk, args_, channelz_node_, socket));
   gpr_log(GPR_INFO, "New connected subchannel at %p for subchannel %p",
           connected_subchannel_.get(), this);
   if (channelz_node_ != nullptr) {
@@ -25,6 +25,7 @@
 
 #include "src/core/ext/filters/client_channel/client_channel_channelz.h"
 #include "src/core/ext/filters/client_channel/connector.h"
+#include "src/core/ext/filters/client_channel/subchannel_interface.h"
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/channel/channel_stack.h"
@@ -75,7 +76,8 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
  public:
   ConnectedSubchannel(
       grpc_channel_stack* channel_stack, const grpc_channel_args* args,
-      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel);
+      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+      RefCountedPtr<channelz::SocketNode> channelz_socket = nullptr);
   ~ConnectedSubchannel();
 
   void StartWatch(grpc_pollset_set* interested_parties,
@@ -88,6 +90,9 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   channelz::SubchannelNode* channelz_subchannel() const {
     return channelz_subchannel_.get();
   }
+  channelz::SocketNode* channelz_socket() const {
+    return channelz_socket_.get();
+  }
 
   size_t GetInitialCallSizeEstimate(size_t parent_data_size) const;
 
@@ -97,6 +102,9 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   // ref counted pointer to the channelz node in this connected subchannel's
   // owning subchannel.
   RefCountedPtr<channelz::SubchannelNode> channelz_subchannel_;
+  // channelz node of the transport's socket, if any.  The transport records
+  // its network estimates there.
+  RefCountedPtr<channelz::SocketNode> channelz_socket_;
 };
 
 // Implements the interface of RefCounted<>.
@@ -288,6 +296,10 @@ class Subchannel {
   // go away.
   void ResetBackoff();
 
+  // Returns the network estimates of the current connection, if any.
+  bool GetConnectionEstimates(
+      SubchannelInterface::ConnectionEstimates* estimates);
+
   // Returns a new channel arg encoding the subchannel address as a URI
   // string. Caller is responsible for freeing the string.
   static grpc_arg CreateSubchannelAddressArg(const grpc_resolved_address* addr);
@@ -85,6 +85,22 @@ class SubchannelInterface : public RefCounted<SubchannelInterface> {
   // attempt will be started as soon as AttemptToConnect() is called.
   virtual void ResetBackoff() = 0;
 
+  // Network estimates measured by the transport of the current connection.
+  struct ConnectionEstimates {
+    // Smoothed round trip time of transport-level pings, in microseconds.
+    int64_t smoothed_rtt_micros = 0;
+    // Estimated bandwidth delay product of the connection, in bytes.
+    int64_t bdp_bytes = 0;
+  };
+
+  // Fills in \a estimates and returns true if the subchannel is connected
+  // and its transport has measured the connection yet.  Estimates are
+  // gathered from the transport's BDP pings and are only available when
+  // channelz is enabled for the connection.
+  virtual bool GetConnectionEstimates(ConnectionEstimates* /*estimates*/) {
+    return false;
+  }
+
   // TODO(roth): Need a better non-grpc-specific abstraction here.
   virtual const grpc_channel_args* channel_args() = 0;
 };
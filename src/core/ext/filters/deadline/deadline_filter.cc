@@ -21,17 +21,151 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include <map>
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/channel_init.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_deadline_coalescing_ms, 0,
+    "If positive, call deadlines are rounded up to a multiple of this many "
+    "milliseconds, and calls whose deadlines round to the same value share a "
+    "single timer.");
+
+//
+// deadline timer coalescing
+//
+
+// A timer shared by all calls whose deadline rounds up to 'deadline'.
+struct grpc_deadline_bucket {
+  grpc_deadline_bucket_shard* shard;
+  grpc_millis deadline;
+  grpc_timer timer;
+  grpc_closure on_timer;
+  // Calls waiting on this bucket, linked through bucket_next/bucket_prev.
+  grpc_deadline_state* calls = nullptr;
+  // Cleared once the bucket leaves its shard's map; no call may join it
+  // after that.
+  bool in_shard = true;
+};
+
+struct grpc_deadline_bucket_shard {
+  grpc_core::Mutex mu;
+  std::map<grpc_millis, grpc_deadline_bucket*> buckets;
+};
+
+#define NUM_DEADLINE_BUCKET_SHARDS 16
+
+static int g_coalescing_ms;
+static gpr_once g_bucket_shards_once = GPR_ONCE_INIT;
+// Never freed: buckets may outlive a grpc_shutdown()/grpc_init() cycle.
+static grpc_deadline_bucket_shard* g_bucket_shards;
+
+static void init_bucket_shards() {
+  g_bucket_shards = new grpc_deadline_bucket_shard[NUM_DEADLINE_BUCKET_SHARDS];
+}
+
+// Runs the timers of every call in the bucket. Also invoked (with
+// GRPC_ERROR_CANCELLED) once the last call has left the bucket, in which case
+// there is nothing left to run.
+static void bucket_timer_callback(void* arg, grpc_error* error) {
+  grpc_deadline_bucket* bucket = static_cast<grpc_deadline_bucket*>(arg);
+  {
+    grpc_core::MutexLock lock(&bucket->shard->mu);
+    if (bucket->in_shard) {
+      bucket->shard->buckets.erase(bucket->deadline);
+      bucket->in_shard = false;
+    }
+    for (grpc_deadline_state* call = bucket->calls; call != nullptr;
+         call = call->bucket_next) {
+      call->bucket = nullptr;
+      grpc_core::ExecCtx::Run(DEBUG_LOCATION, call->bucket_closure,
+                              GRPC_ERROR_REF(error));
+    }
+  }
+  delete bucket;
+}
+
+// Starts the timer for deadline_state, sharing it with other calls if
+// deadline coalescing is enabled.
+static void deadline_timer_init(grpc_deadline_state* deadline_state,
+                                grpc_millis deadline, grpc_closure* closure) {
+  const grpc_millis granularity = g_coalescing_ms;
+  if (granularity <= 0 || deadline <= 0 ||
+      deadline > GRPC_MILLIS_INF_FUTURE - granularity) {
+    deadline_state->bucket_shard = nullptr;
+    grpc_timer_init(&deadline_state->timer, deadline, closure);
+    return;
+  }
+  gpr_once_init(&g_bucket_shards_once, init_bucket_shards);
+  grpc_millis rounded = (deadline + granularity - 1) / granularity;
+  grpc_deadline_bucket_shard* shard =
+      &g_bucket_shards[rounded % NUM_DEADLINE_BUCKET_SHARDS];
+  rounded *= granularity;
+  grpc_core::MutexLock lock(&shard->mu);
+  grpc_deadline_bucket*& bucket = shard->buckets[rounded];
+  const bool new_bucket = bucket == nullptr;
+  if (new_bucket) {
+    bucket = new grpc_deadline_bucket();
+    bucket->shard = shard;
+    bucket->deadline = rounded;
+    GRPC_CLOSURE_INIT(&bucket->on_timer, bucket_timer_callback, bucket,
+                      grpc_schedule_on_exec_ctx);
+  }
+  deadline_state->bucket_shard = shard;
+  deadline_state->bucket = bucket;
+  deadline_state->bucket_closure = closure;
+  deadline_state->bucket_prev = nullptr;
+  deadline_state->bucket_next = bucket->calls;
+  if (bucket->calls != nullptr) bucket->calls->bucket_prev = deadline_state;
+  bucket->calls = deadline_state;
+  // The timer closure is scheduled on the exec_ctx, so it cannot run while
+  // we hold the shard lock.
+  if (new_bucket) grpc_timer_init(&bucket->timer, rounded, &bucket->on_timer);
+}
+
+// Cancels the timer started by deadline_timer_init().
+static void deadline_timer_cancel(grpc_deadline_state* deadline_state) {
+  grpc_deadline_bucket_shard* shard = deadline_state->bucket_shard;
+  if (shard == nullptr) {
+    grpc_timer_cancel(&deadline_state->timer);
+    return;
+  }
+  deadline_state->bucket_shard = nullptr;
+  grpc_core::MutexLock lock(&shard->mu);
+  grpc_deadline_bucket* bucket = deadline_state->bucket;
+  // Already run by the bucket's timer.
+  if (bucket == nullptr) return;
+  if (deadline_state->bucket_prev != nullptr) {
+    deadline_state->bucket_prev->bucket_next = deadline_state->bucket_next;
+  } else {
+    bucket->calls = deadline_state->bucket_next;
+  }
+  if (deadline_state->bucket_next != nullptr) {
+    deadline_state->bucket_next->bucket_prev = deadline_state->bucket_prev;
+  }
+  deadline_state->bucket = nullptr;
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, deadline_state->bucket_closure,
+                          GRPC_ERROR_CANCELLED);
+  if (bucket->calls == nullptr) {
+    // Last call out: the bucket is freed by its timer callback, which cannot
+    // run before we release the lock.
+    shard->buckets.erase(bucket->deadline);
+    bucket->in_shard = false;
+    grpc_timer_cancel(&bucket->timer);
+  }
+}
+
 //
 // grpc_deadline_state
 //
@@ -112,7 +246,7 @@ static void start_timer_if_needed(grpc_call_element* elem,
   }
   GPR_ASSERT(closure != nullptr);
   GRPC_CALL_STACK_REF(deadline_state->call_stack, "deadline_timer");
-  grpc_timer_init(&deadline_state->timer, deadline, closure);
+  deadline_timer_init(deadline_state, deadline, closure);
 }
 
 // Cancels the deadline timer.
@@ -121,7 +255,7 @@ static void start_timer_if_needed(grpc_call_element* elem,
 static void cancel_timer_if_needed(grpc_deadline_state* deadline_state) {
   if (deadline_state->timer_state == GRPC_DEADLINE_STATE_PENDING) {
     deadline_state->timer_state = GRPC_DEADLINE_STATE_FINISHED;
-    grpc_timer_cancel(&deadline_state->timer);
+    deadline_timer_cancel(deadline_state);
   } else {
     // timer was either in STATE_INITIAL (nothing to cancel)
     // OR in STATE_FINISHED (again nothing to cancel)
@@ -375,6 +509,7 @@ static bool maybe_add_deadline_filter(grpc_channel_stack_builder* builder,
 }
 
 void grpc_deadline_filter_init(void) {
+  g_coalescing_ms = GPR_GLOBAL_CONFIG_GET(grpc_deadline_coalescing_ms);
   grpc_channel_init_register_stage(
       GRPC_CLIENT_DIRECT_CHANNEL, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
       maybe_add_deadline_filter, (void*)&grpc_client_deadline_filter);
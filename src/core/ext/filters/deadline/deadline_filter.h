@@ -22,6 +22,9 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/iomgr/timer.h"
 
+struct grpc_deadline_bucket;
+struct grpc_deadline_bucket_shard;
+
 enum grpc_deadline_timer_state {
   GRPC_DEADLINE_STATE_INITIAL,
   GRPC_DEADLINE_STATE_PENDING,
@@ -42,6 +45,14 @@ struct grpc_deadline_state {
   grpc_deadline_timer_state timer_state = GRPC_DEADLINE_STATE_INITIAL;
   grpc_timer timer;
   grpc_closure timer_callback;
+  // Set while the timer is coalesced with those of other calls (see
+  // GRPC_DEADLINE_COALESCING_MS).  'bucket' and the links are guarded by
+  // the shard's lock; 'bucket_shard' only changes under the call combiner.
+  grpc_deadline_bucket_shard* bucket_shard = nullptr;
+  grpc_deadline_bucket* bucket = nullptr;
+  grpc_deadline_state* bucket_next = nullptr;
+  grpc_deadline_state* bucket_prev = nullptr;
+  grpc_closure* bucket_closure = nullptr;
   // Closure to invoke when we receive trailing metadata.
   // We use this to cancel the timer.
   grpc_closure recv_trailing_metadata_ready;
@@ -110,13 +110,25 @@ bool grpc_base64_decode_partial(struct grpc_base64_decode_context* ctx) {
     return false;
   }
 
-  // Process a block of 4 input characters and 3 output bytes
+  // Process a block of 4 input characters and 3 output bytes. Each character
+  // is looked up once: invalid ones map to 0x40, so OR-ing the four values
+  // together checks them all.
   while (ctx->input_end >= ctx->input_cur + 4 &&
          ctx->output_end >= ctx->output_cur + 3) {
-    if (!input_is_valid(ctx->input_cur, 4)) return false;
-    ctx->output_cur[0] = COMPOSE_OUTPUT_BYTE_0(ctx->input_cur);
-    ctx->output_cur[1] = COMPOSE_OUTPUT_BYTE_1(ctx->input_cur);
-    ctx->output_cur[2] = COMPOSE_OUTPUT_BYTE_2(ctx->input_cur);
+    const uint8_t a = decode_table[ctx->input_cur[0]];
+    const uint8_t b = decode_table[ctx->input_cur[1]];
+    const uint8_t c = decode_table[ctx->input_cur[2]];
+    const uint8_t d = decode_table[ctx->input_cur[3]];
+    if (GPR_UNLIKELY(((a | b | c | d) & 0xC0) != 0)) {
+      // Let input_is_valid() report the offending character.
+      return input_is_valid(ctx->input_cur, 4);
+    }
+    const uint32_t block = (static_cast<uint32_t>(a) << 18) |
+                           (static_cast<uint32_t>(b) << 12) |
+                           (static_cast<uint32_t>(c) << 6) | d;
+    ctx->output_cur[0] = static_cast<uint8_t>(block >> 16);
+    ctx->output_cur[1] = static_cast<uint8_t>(block >> 8);
+    ctx->output_cur[2] = static_cast<uint8_t>(block);
     ctx->output_cur += 3;
     ctx->input_cur += 4;
   }
@@ -136,7 +136,9 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
 }
 
 struct huff_out {
-  uint32_t temp;
+  /* wide enough to take a whole triplet's four symbols (at most 44 bits) on
+     top of the (at most 8) bits not yet flushed */
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
@@ -157,6 +159,23 @@ static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
   enc_flush_some(out);
 }
 
+static void enc_add4(huff_out* out, uint8_t a, uint8_t b, uint8_t c,
+                     uint8_t d) {
+  b64_huff_sym sa = huff_alphabet[a];
+  b64_huff_sym sb = huff_alphabet[b];
+  b64_huff_sym sc = huff_alphabet[c];
+  b64_huff_sym sd = huff_alphabet[d];
+  const uint32_t length = static_cast<uint32_t>(sa.length) + sb.length +
+                          sc.length + sd.length;
+  out->temp = (out->temp << length) |
+              (static_cast<uint64_t>(sa.bits)
+               << (sb.length + sc.length + sd.length)) |
+              (static_cast<uint64_t>(sb.bits) << (sc.length + sd.length)) |
+              (static_cast<uint64_t>(sc.bits) << sd.length) | sd.bits;
+  out->temp_length += length;
+  enc_flush_some(out);
+}
+
 static void enc_add1(huff_out* out, uint8_t a) {
   b64_huff_sym sa = huff_alphabet[a];
   out->temp = (out->temp << sa.length) | sa.bits;
@@ -184,13 +203,12 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
 
   /* encode full triplets */
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    enc_add4(&out, static_cast<uint8_t>(triplet >> 18),
+             static_cast<uint8_t>((triplet >> 12) & 0x3f),
+             static_cast<uint8_t>((triplet >> 6) & 0x3f),
+             static_cast<uint8_t>(triplet & 0x3f));
     in += 3;
   }
 
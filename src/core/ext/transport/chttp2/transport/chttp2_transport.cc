@@ -104,6 +104,7 @@ grpc_core::DebugOnlyTraceFlag grpc_trace_chttp2_refcount(false,
 
 // forward declarations of various callbacks that we'll build closures around
 static void write_action_begin_locked(void* t, grpc_error* error);
+static void write_action_uncork(void* t, grpc_error* error);
 static void write_action(void* t, grpc_error* error);
 static void write_action_end(void* t, grpc_error* error);
 static void write_action_end_locked(void* t, grpc_error* error);
@@ -294,6 +295,21 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                            GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)) {
       t->write_buffer_size = static_cast<uint32_t>(grpc_channel_arg_get_integer(
           &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_COALESCING)) {
+      t->coalesce_writes =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES)) {
+      t->write_quantum_bytes = static_cast<uint32_t>(
+          grpc_channel_arg_get_integer(&channel_args->args[i], {0, 0, INT_MAX}));
+    } else if (0 ==
+               strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_CORK_WRITES)) {
+      t->cork_writes = grpc_channel_arg_get_bool(&channel_args->args[i], false);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_HPACK_CACHE_HEADER_BLOCKS)) {
+      t->hpack_compressor.cache_header_blocks =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false);
     } else if (0 ==
                strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
       enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
@@ -903,6 +919,22 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
       // Also, 'write_action_begin_locked' only gathers the bytes into outbuf.
       // It does not call the endpoint to write the bytes. That is done by the
       // 'write_action' (which is scheduled by 'write_action_begin_locked')
+      //
+      // When cork_writes is set, the finally_scheduler only batches what is
+      // queued on the combiner right now. Ops started by other closures on the
+      // same ExecCtx (e.g. several batches issued from one callback) would
+      // each otherwise get their own endpoint write, so the write is held back
+      // until the ExecCtx goes idle and then uncorked onto the combiner. The
+      // write state stays WRITING in between, so later initiations just fold
+      // into it.
+      if (t->cork_writes) {
+        grpc_core::ExecCtx::RunWhenIdle(
+            DEBUG_LOCATION,
+            GRPC_CLOSURE_INIT(&t->write_action_uncork, write_action_uncork, t,
+                              grpc_schedule_on_exec_ctx),
+            GRPC_ERROR_NONE);
+        break;
+      }
       t->combiner->FinallyRun(
           GRPC_CLOSURE_INIT(&t->write_action_begin_locked,
                             write_action_begin_locked, t, nullptr),
@@ -972,6 +1004,14 @@ static void write_action_begin_locked(void* gt, grpc_error* /*error_ignored*/) {
   }
 }
 
+static void write_action_uncork(void* gt, grpc_error* /*error*/) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
+  t->combiner->FinallyRun(
+      GRPC_CLOSURE_INIT(&t->write_action_begin_locked,
+                        write_action_begin_locked, t, nullptr),
+      GRPC_ERROR_NONE);
+}
+
 static void write_action(void* gt, grpc_error* /*error*/) {
   GPR_TIMER_SCOPE("write_action", 0);
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
@@ -2642,6 +2682,15 @@ static void finish_bdp_ping_locked(void* tp, grpc_error* error) {
   grpc_millis next_ping = t->flow_control->bdp_estimator()->CompletePing();
   grpc_chttp2_act_on_flowctl_action(t->flow_control->PeriodicUpdate(), t,
                                     nullptr);
+  if (t->channelz_socket != nullptr) {
+    t->channelz_socket->RecordWriteSizing(
+        t->flow_control->target_frame_size(),
+        t->flow_control->target_write_size());
+    t->channelz_socket->RecordNetworkEstimates(
+        static_cast<int64_t>(t->flow_control->bdp_estimator()->EstimateRtt() *
+                             1e6),
+        t->flow_control->bdp_estimator()->EstimateBdp());
+  }
   GPR_ASSERT(!t->have_next_bdp_ping_timer);
   t->have_next_bdp_ping_timer = true;
   GRPC_CLOSURE_INIT(&t->next_bdp_ping_timer_expired_locked,
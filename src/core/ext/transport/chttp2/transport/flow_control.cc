@@ -44,6 +44,18 @@ namespace {
 
 static constexpr const int kTracePadding = 30;
 static constexpr const uint32_t kMaxWindowUpdateSize = (1u << 31) - 1;
+// Memory pressure above which flow control windows stop growing, and at which
+// they are back down to their floor.
+static constexpr const double kHighMemPressure = 0.8;
+static constexpr const double kMaxMemPressure = 0.9;
+
+// Fraction of a window increase that may be granted under the given memory
+// pressure.
+static double WindowGrowthAllowance(double memory_pressure) {
+  if (memory_pressure <= kHighMemPressure) return 1;
+  return 1 - GPR_MIN(1, (memory_pressure - kHighMemPressure) /
+                            (kMaxMemPressure - kHighMemPressure));
+}
 
 static char* fmt_int64_diff_str(int64_t old_val, int64_t new_val) {
   std::string str;
@@ -292,6 +304,15 @@ void StreamFlowControl::IncomingByteStreamUpdate(size_t max_size_hint,
     max_recv_bytes = 0;
   }
 
+  /* under memory pressure, only let the stream window grow past the initial
+     window by part of what the application asked for (none at all under
+     heavy pressure): data the peer sends ahead of a slow reader is buffered
+     in frame_storage until it is read */
+  const double allowance = WindowGrowthAllowance(tfc_->MemoryPressure());
+  if (allowance < 1) {
+    max_recv_bytes = static_cast<uint32_t>(max_recv_bytes * allowance);
+  }
+
   /* add some small lookahead to keep pipelines flowing */
   GPR_DEBUG_ASSERT(max_recv_bytes <= kMaxWindowUpdateSize - sent_init_window);
   if (local_window_delta_ < max_recv_bytes) {
@@ -308,18 +329,20 @@ static double AdjustForMemoryPressure(grpc_resource_quota* quota,
   double memory_pressure = grpc_resource_quota_get_memory_pressure(quota);
   static const double kLowMemPressure = 0.1;
   static const double kZeroTarget = 22;
-  static const double kHighMemPressure = 0.8;
-  static const double kMaxMemPressure = 0.9;
   if (memory_pressure < kLowMemPressure && target < kZeroTarget) {
     target = (target - kZeroTarget) * memory_pressure / kLowMemPressure +
              kZeroTarget;
   } else if (memory_pressure > kHighMemPressure) {
-    target *= 1 - GPR_MIN(1, (memory_pressure - kHighMemPressure) /
-                                 (kMaxMemPressure - kHighMemPressure));
+    target *= WindowGrowthAllowance(memory_pressure);
   }
   return target;
 }
 
+double TransportFlowControl::MemoryPressure() const {
+  return grpc_resource_quota_get_memory_pressure(
+      grpc_resource_user_quota(grpc_endpoint_get_resource_user(t_->ep)));
+}
+
 double TransportFlowControl::TargetLogBdp() {
   return AdjustForMemoryPressure(
       grpc_resource_user_quota(grpc_endpoint_get_resource_user(t_->ep)),
@@ -377,6 +400,13 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
         DeltaUrgency(static_cast<int64_t>(frame_size),
                      GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE),
         frame_size);
+
+    // Size outgoing traffic off the same estimates: a high-BDP link gets
+    // large frames and large writes so that it can be kept full, a
+    // low-latency link keeps small ones so that streams interleave finely.
+    target_frame_size_ = static_cast<uint32_t>(frame_size);
+    target_write_size_ = static_cast<uint32_t> GPR_CLAMP(
+        target_initial_window_size_, kMinTargetWriteSize, kMaxTargetWriteSize);
   }
   return UpdateAction(action);
 }
@@ -47,6 +47,14 @@ static constexpr uint32_t kDefaultWindow = 65535;
 static constexpr int64_t kMaxWindow = static_cast<int64_t>((1u << 31) - 1);
 // TODO(ncteisen): Tune this
 static constexpr uint32_t kFrameSize = 1024 * 1024;
+// How many bytes we would like to put on the wire during a single syscall
+// before the BDP estimator has told us anything about the link.
+static constexpr uint32_t kDefaultTargetWriteSize = 1024 * 1024;
+// Bounds for the BDP driven target write size.
+static constexpr uint32_t kMinTargetWriteSize = 64 * 1024;
+static constexpr uint32_t kMaxTargetWriteSize = 8 * 1024 * 1024;
+// Largest frame size allowed by HTTP/2.
+static constexpr uint32_t kMaxFrameSize = 16777215;
 
 class TransportFlowControl;
 class StreamFlowControl;
@@ -183,6 +191,12 @@ class TransportFlowControlBase {
   virtual int64_t target_window() const { return target_initial_window_size_; }
   int64_t announced_window() const { return announced_window_; }
 
+  // Largest DATA frame we would like to send; the peer's
+  // SETTINGS_MAX_FRAME_SIZE still bounds what is actually sent.
+  uint32_t target_frame_size() const { return target_frame_size_; }
+  // How many bytes we would like to put on the wire during a single write.
+  uint32_t target_write_size() const { return target_write_size_; }
+
   // Used in certain benchmarks in which we don't want FlowControl to be a
   // factor
   virtual void TestOnlyForceHugeWindow() {}
@@ -192,6 +206,8 @@ class TransportFlowControlBase {
   int64_t remote_window_ = kDefaultWindow;
   int64_t target_initial_window_size_ = kDefaultWindow;
   int64_t announced_window_ = kDefaultWindow;
+  uint32_t target_frame_size_ = kMaxFrameSize;
+  uint32_t target_write_size_ = kDefaultTargetWriteSize;
 };
 
 // Implementation of flow control that does NOTHING. Always returns maximum
@@ -276,6 +292,11 @@ class TransportFlowControl final : public TransportFlowControlBase {
 
   const grpc_chttp2_transport* transport() const { return t_; }
 
+  // Memory pressure of the resource quota the transport's endpoint allocates
+  // its reads from (which incoming message bytes stay charged to until they
+  // are consumed).
+  double MemoryPressure() const;
+
   void PreUpdateAnnouncedWindowOverIncomingWindow(int64_t delta) {
     if (delta > 0) {
       announced_stream_total_over_incoming_window_ -= delta;
@@ -89,6 +89,20 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   stats->data_bytes += write_bytes;
 }
 
+/* Removes the first slice of slices and returns its bytes from offset
+   onwards. When the message owns the whole slice its reference is handed over
+   as is, so payload read from the endpoint reaches the byte stream without a
+   new (sub-)slice or refcount round trip. */
+static grpc_slice take_first_from(grpc_slice_buffer* slices, size_t offset) {
+  if (offset == 0) {
+    return grpc_slice_buffer_take_first(slices);
+  }
+  grpc_slice* first = grpc_slice_buffer_peek_first(slices);
+  grpc_slice out = grpc_slice_sub(*first, offset, GRPC_SLICE_LENGTH(*first));
+  grpc_slice_buffer_remove_first(slices);
+  return out;
+}
+
 grpc_error* grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_data_parser* p, grpc_chttp2_stream* s,
     grpc_slice_buffer* slices, grpc_slice* slice_out,
@@ -218,32 +232,26 @@ grpc_error* grpc_deframe_unprocessed_incoming_frames(
           s->stats.incoming.data_bytes += remaining;
           if (GRPC_ERROR_NONE !=
               (error = p->parsing_frame->Push(
-                   grpc_slice_sub(*slice, static_cast<size_t>(cur - beg),
-                                  static_cast<size_t>(end - beg)),
+                   take_first_from(slices, static_cast<size_t>(cur - beg)),
                    slice_out))) {
-            grpc_slice_buffer_remove_first(slices);
             return error;
           }
           if (GRPC_ERROR_NONE !=
               (error = p->parsing_frame->Finished(GRPC_ERROR_NONE, true))) {
-            grpc_slice_buffer_remove_first(slices);
             return error;
           }
           p->parsing_frame = nullptr;
           p->state = GRPC_CHTTP2_DATA_FH_0;
-          grpc_slice_buffer_remove_first(slices);
           return GRPC_ERROR_NONE;
         } else if (remaining < p->frame_size) {
           s->stats.incoming.data_bytes += remaining;
           if (GRPC_ERROR_NONE !=
               (error = p->parsing_frame->Push(
-                   grpc_slice_sub(*slice, static_cast<size_t>(cur - beg),
-                                  static_cast<size_t>(end - beg)),
+                   take_first_from(slices, static_cast<size_t>(cur - beg)),
                    slice_out))) {
             return error;
           }
           p->frame_size -= remaining;
-          grpc_slice_buffer_remove_first(slices);
           return GRPC_ERROR_NONE;
         } else {
           GPR_ASSERT(remaining > p->frame_size);
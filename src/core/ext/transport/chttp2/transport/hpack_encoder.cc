@@ -278,6 +278,12 @@ struct framer_state {
   size_t max_frame_size;
   bool use_true_binary_metadata;
   bool is_end_of_stream;
+  /* bytes of the indexed fields emitted so far, recorded for the compressor's
+     cached_block; indexed_length exceeds the buffer once it has overflowed */
+  uint8_t indexed[GRPC_CHTTP2_HPACKC_CACHED_BLOCK_BYTES];
+  size_t indexed_length;
+  /* set once any field is emitted as a literal: such blocks are not cached */
+  bool emitted_literal;
 };
 /* fills p (which is expected to be kDataFrameHeaderSize bytes long)
  * with a data frame header */
@@ -405,6 +411,8 @@ static uint32_t prepare_space_for_new_elem(grpc_chttp2_hpack_compressor* c,
                                            size_t elem_size) {
   uint32_t new_index = c->tail_remote_index + c->table_elems + 1;
   GPR_DEBUG_ASSERT(elem_size < 65536);
+  /* dynamic indices are about to shift */
+  c->cached_block.valid = false;
 
   // TODO(arjunroy): Re-examine semantics
   if (elem_size > c->max_table_size) {
@@ -464,12 +472,35 @@ static void add_key(grpc_chttp2_hpack_compressor* c, grpc_mdelem elem,
   }
 }
 
+static void record_indexed(framer_state* st, const uint8_t* data,
+                           uint32_t len) {
+  if (st->indexed_length + len <= sizeof(st->indexed)) {
+    memcpy(st->indexed + st->indexed_length, data, len);
+  }
+  st->indexed_length += len;
+}
+
 static void emit_indexed(grpc_chttp2_hpack_compressor* /*c*/,
                          uint32_t elem_index, framer_state* st) {
   GRPC_STATS_INC_HPACK_SEND_INDEXED();
   uint32_t len = GRPC_CHTTP2_VARINT_LENGTH(elem_index, 1);
-  GRPC_CHTTP2_WRITE_VARINT(elem_index, 1, 0x80, add_tiny_header_data(st, len),
-                           len);
+  uint8_t* data = add_tiny_header_data(st, len);
+  GRPC_CHTTP2_WRITE_VARINT(elem_index, 1, 0x80, data, len);
+  record_indexed(st, data, len);
+}
+
+/* Every HPACK static table index fits in the 7-bit prefix of an indexed
+   field, so the encoding of a static element is one byte known up front. */
+static_assert(GRPC_CHTTP2_LAST_STATIC_ENTRY < 0x7f,
+              "static table indices must encode to a single byte");
+#define STATIC_INDEXED_FIELD(i) static_cast<uint8_t>(0x80 | ((i) + 1))
+
+static void emit_static_indexed(grpc_chttp2_hpack_compressor* /*c*/,
+                                uintptr_t static_index, framer_state* st) {
+  GRPC_STATS_INC_HPACK_SEND_INDEXED();
+  uint8_t* data = add_tiny_header_data(st, 1);
+  data[0] = STATIC_INDEXED_FIELD(static_index);
+  record_indexed(st, data, 1);
 }
 
 struct wire_value {
@@ -533,6 +564,7 @@ static void emit_lithdr(grpc_chttp2_hpack_compressor* /*c*/, uint32_t key_index,
       GRPC_STATS_INC_HPACK_SEND_LITHDR_NOTIDX();
       break;
   }
+  st->emitted_literal = true;
   const uint32_t len_pfx = type == EmitLitHdrType::INC_IDX
                                ? GRPC_CHTTP2_VARINT_LENGTH(key_index, 2)
                                : GRPC_CHTTP2_VARINT_LENGTH(key_index, 4);
@@ -571,6 +603,7 @@ static void emit_lithdr_v(grpc_chttp2_hpack_compressor* /*c*/, grpc_mdelem elem,
       GRPC_STATS_INC_HPACK_SEND_LITHDR_NOTIDX_V();
       break;
   }
+  st->emitted_literal = true;
   GRPC_STATS_INC_HPACK_SEND_UNCOMPRESSED();
   const uint32_t len_key =
       static_cast<uint32_t>(GRPC_SLICE_LENGTH(GRPC_MDKEY(elem)));
@@ -756,6 +789,22 @@ static void deadline_enc(grpc_chttp2_hpack_compressor* c, grpc_millis deadline,
   GRPC_MDELEM_UNREF(mdelem);
 }
 
+/* encode an element of a header block, taking the single byte path for
+   elements of the HPACK static table */
+static void encode_elem(grpc_chttp2_hpack_compressor* c, grpc_mdelem elem,
+                        framer_state* st) {
+  if (GRPC_MDELEM_STORAGE(elem) == GRPC_MDELEM_STORAGE_STATIC) {
+    const uintptr_t static_index =
+        reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(elem))
+            ->StaticIndex();
+    if (static_index < GRPC_CHTTP2_LAST_STATIC_ENTRY) {
+      emit_static_indexed(c, static_index, st);
+      return;
+    }
+  }
+  hpack_enc(c, elem, st);
+}
+
 static uint32_t elems_for_bytes(uint32_t bytes) { return (bytes + 31) / 32; }
 
 void grpc_chttp2_hpack_compressor_init(grpc_chttp2_hpack_compressor* c) {
@@ -815,6 +864,7 @@ void grpc_chttp2_hpack_compressor_set_max_table_size(
   while (c->table_size > 0 && c->table_size > max_table_size) {
     evict_entry(c);
   }
+  c->cached_block.valid = false;
   c->max_table_size = max_table_size;
   c->max_table_elems = elems_for_bytes(max_table_size);
   if (c->max_table_elems > c->cap_table_elems) {
@@ -831,6 +881,33 @@ void grpc_chttp2_hpack_compressor_set_max_table_size(
   }
 }
 
+/* collect the identities of the elements a header block would encode, for
+   matching against the compressor's cached_block; returns false if the block
+   cannot be cached */
+static bool get_block_elems(grpc_mdelem** extra_headers,
+                            size_t extra_headers_size,
+                            grpc_metadata_batch* metadata, uintptr_t* elems,
+                            uint8_t* elems_count) {
+  /* the timeout is re-encoded relative to now on every call */
+  if (metadata->deadline != GRPC_MILLIS_INF_FUTURE) {
+    return false;
+  }
+  size_t count = extra_headers_size + metadata->list.count;
+  if (count > GRPC_CHTTP2_HPACKC_CACHED_BLOCK_ELEMS) {
+    return false;
+  }
+  size_t n = 0;
+  for (size_t i = 0; i < extra_headers_size; ++i) {
+    elems[n++] = extra_headers[i]->payload;
+  }
+  for (grpc_linked_mdelem* l = metadata->list.head; l; l = l->next) {
+    elems[n++] = l->md.payload;
+  }
+  GPR_DEBUG_ASSERT(n == count);
+  *elems_count = static_cast<uint8_t>(n);
+  return true;
+}
+
 void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
                                grpc_mdelem** extra_headers,
                                size_t extra_headers_size,
@@ -854,6 +931,8 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   st.max_frame_size = options->max_frame_size;
   st.use_true_binary_metadata = options->use_true_binary_metadata;
   st.is_end_of_stream = options->is_eof;
+  st.indexed_length = 0;
+  st.emitted_literal = false;
 
   /* Encode a metadata batch; store the returned values, representing
      a metadata element that needs to be unreffed back into the metadata
@@ -863,38 +942,43 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   if (c->advertise_table_size_change != 0) {
     emit_advertise_table_size_change(c, &st);
   }
+  uintptr_t elems[GRPC_CHTTP2_HPACKC_CACHED_BLOCK_ELEMS];
+  uint8_t elems_count = 0;
+  const bool cacheable =
+      c->cache_header_blocks &&
+      get_block_elems(extra_headers, extra_headers_size, metadata, elems,
+                      &elems_count);
+  if (cacheable && c->cached_block.valid &&
+      c->cached_block.elems_count == elems_count &&
+      memcmp(c->cached_block.elems, elems, elems_count * sizeof(*elems)) ==
+          0) {
+    /* same elements against the same table: re-emit the recorded bytes */
+    ensure_space(&st, c->cached_block.length);
+    st.stats->header_bytes += c->cached_block.length;
+    grpc_slice_buffer_append_copied(st.output, c->cached_block.bytes,
+                                    c->cached_block.length);
+    finish_frame(&st, 1);
+    return;
+  }
   for (size_t i = 0; i < extra_headers_size; ++i) {
-    grpc_mdelem md = *extra_headers[i];
-    const bool is_static =
-        GRPC_MDELEM_STORAGE(md) == GRPC_MDELEM_STORAGE_STATIC;
-    uintptr_t static_index;
-    if (is_static &&
-        (static_index =
-             reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(md))
-                 ->StaticIndex()) < GRPC_CHTTP2_LAST_STATIC_ENTRY) {
-      emit_indexed(c, static_cast<uint32_t>(static_index + 1), &st);
-    } else {
-      hpack_enc(c, md, &st);
-    }
+    encode_elem(c, *extra_headers[i], &st);
   }
   grpc_metadata_batch_assert_ok(metadata);
   for (grpc_linked_mdelem* l = metadata->list.head; l; l = l->next) {
-    const bool is_static =
-        GRPC_MDELEM_STORAGE(l->md) == GRPC_MDELEM_STORAGE_STATIC;
-    uintptr_t static_index;
-    if (is_static &&
-        (static_index = reinterpret_cast<grpc_core::StaticMetadata*>(
-                            GRPC_MDELEM_DATA(l->md))
-                            ->StaticIndex()) < GRPC_CHTTP2_LAST_STATIC_ENTRY) {
-      emit_indexed(c, static_cast<uint32_t>(static_index + 1), &st);
-    } else {
-      hpack_enc(c, l->md, &st);
-    }
+    encode_elem(c, l->md, &st);
   }
   grpc_millis deadline = metadata->deadline;
   if (deadline != GRPC_MILLIS_INF_FUTURE) {
     deadline_enc(c, deadline, &st);
   }
+  if (cacheable && !st.emitted_literal &&
+      st.indexed_length <= sizeof(st.indexed)) {
+    c->cached_block.valid = true;
+    c->cached_block.elems_count = elems_count;
+    memcpy(c->cached_block.elems, elems, elems_count * sizeof(*elems));
+    c->cached_block.length = static_cast<uint8_t>(st.indexed_length);
+    memcpy(c->cached_block.bytes, st.indexed, st.indexed_length);
+  }
 
   finish_frame(&st, 1);
 }
@@ -35,6 +35,9 @@
 #define GRPC_CHTTP2_HPACKC_INITIAL_TABLE_SIZE 4096
 /* maximum table size we'll actually use */
 #define GRPC_CHTTP2_HPACKC_MAX_TABLE_SIZE (1024 * 1024)
+/* limits on the header blocks remembered for re-emission */
+#define GRPC_CHTTP2_HPACKC_CACHED_BLOCK_ELEMS 8
+#define GRPC_CHTTP2_HPACKC_CACHED_BLOCK_BYTES 32
 
 extern grpc_core::TraceFlag grpc_http_trace;
 
@@ -81,6 +84,20 @@ struct grpc_chttp2_hpack_compressor {
       uint32_t index;
     } entries[GRPC_CHTTP2_HPACKC_NUM_VALUES];
   } key_table; /* Key table management */
+
+  /* the most recently encoded header block, if every field in it was emitted
+     as an index: until the dynamic table next changes, the same sequence of
+     elements encodes to exactly these bytes. Elements are compared by
+     identity; indexed elements are static or held by elem_table, so they
+     stay alive for as long as the entry is valid. */
+  bool cache_header_blocks;
+  struct {
+    bool valid;
+    uint8_t elems_count;
+    uint8_t length;
+    uintptr_t elems[GRPC_CHTTP2_HPACKC_CACHED_BLOCK_ELEMS];
+    uint8_t bytes[GRPC_CHTTP2_HPACKC_CACHED_BLOCK_BYTES];
+  } cached_block;
 };
 
 void grpc_chttp2_hpack_compressor_init(grpc_chttp2_hpack_compressor* c);
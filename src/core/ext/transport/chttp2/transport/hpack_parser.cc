@@ -1259,8 +1259,11 @@ static void append_bytes(grpc_chttp2_hpack_parser_string* str,
   if (length == 0) return;
   if (length + str->data.copied.length > str->data.copied.capacity) {
     GPR_ASSERT(str->data.copied.length + length <= UINT32_MAX);
-    str->data.copied.capacity =
-        static_cast<uint32_t>(str->data.copied.length + length);
+    /* grow geometrically: long values arrive in several appends */
+    const uint64_t doubled =
+        2 * static_cast<uint64_t>(str->data.copied.capacity);
+    str->data.copied.capacity = static_cast<uint32_t>(GPR_MIN(
+        UINT32_MAX, GPR_MAX(str->data.copied.length + length, doubled)));
     str->data.copied.str = static_cast<char*>(
         gpr_realloc(str->data.copied.str, str->data.copied.capacity));
   }
@@ -1413,32 +1416,37 @@ static grpc_error* finish_str(grpc_chttp2_hpack_parser* p, const uint8_t* cur,
   return GRPC_ERROR_NONE;
 }
 
-/* decode a nibble from a huffman encoded stream */
-static grpc_error* huff_nibble(grpc_chttp2_hpack_parser* p, uint8_t nibble) {
-  int16_t emit = emit_sub_tbl[16 * emit_tbl[p->huff_state] + nibble];
-  int16_t next = next_sub_tbl[16 * next_tbl[p->huff_state] + nibble];
-  if (emit != -1) {
-    if (emit >= 0 && emit < 256) {
-      uint8_t c = static_cast<uint8_t>(emit);
-      grpc_error* err = append_string(p, &c, (&c) + 1);
-      if (err != GRPC_ERROR_NONE) return err;
-    } else {
-      assert(emit == 256);
-    }
+/* decode a nibble from a huffman encoded stream, advancing *state and
+   appending any decoded symbol at *out */
+static inline void huff_nibble(int16_t* state, uint8_t nibble, uint8_t** out) {
+  int16_t emit = emit_sub_tbl[16 * emit_tbl[*state] + nibble];
+  *state = next_sub_tbl[16 * next_tbl[*state] + nibble];
+  if (emit >= 0 && emit < 256) {
+    *(*out)++ = static_cast<uint8_t>(emit);
+  } else {
+    assert(emit == -1 || emit == 256);
   }
-  p->huff_state = next;
-  return GRPC_ERROR_NONE;
 }
 
-/* decode full bytes from a huffman encoded stream */
+/* decode full bytes from a huffman encoded stream: symbols are decoded a
+   byte (two nibbles, so at most two symbols) at a time into a local buffer,
+   which is handed to append_string in chunks instead of once per symbol */
 static grpc_error* add_huff_bytes(grpc_chttp2_hpack_parser* p,
                                   const uint8_t* cur, const uint8_t* end) {
-  for (; cur != end; ++cur) {
-    grpc_error* err = huff_nibble(p, *cur >> 4);
-    if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
-    err = huff_nibble(p, *cur & 0xf);
+  uint8_t decoded[256];
+  int16_t state = p->huff_state;
+  while (cur != end) {
+    uint8_t* out = decoded;
+    const uint8_t* chunk_end =
+        cur + GPR_MIN(static_cast<size_t>(end - cur), sizeof(decoded) / 2);
+    for (; cur != chunk_end; ++cur) {
+      huff_nibble(&state, *cur >> 4, &out);
+      huff_nibble(&state, *cur & 0xf, &out);
+    }
+    grpc_error* err = append_string(p, decoded, out);
     if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
   }
+  p->huff_state = state;
   return GRPC_ERROR_NONE;
 }
 
@@ -1474,21 +1482,57 @@ static grpc_error* parse_string(grpc_chttp2_hpack_parser* p, const uint8_t* cur,
   }
 }
 
+/* skip the source bytes of a string that was referenced rather than copied
+   but extends past the chunk being parsed */
+static grpc_error* skip_referenced_string(grpc_chttp2_hpack_parser* p,
+                                          const uint8_t* cur,
+                                          const uint8_t* end) {
+  size_t remaining = p->strlen - p->strgot;
+  size_t given = static_cast<size_t>(end - cur);
+  if (remaining <= given) {
+    return parse_next(p, cur + remaining, end);
+  }
+  p->strgot += static_cast<uint32_t>(given);
+  p->state = skip_referenced_string;
+  return GRPC_ERROR_NONE;
+}
+
+/* make str a reference to the next length bytes of the slice being parsed
+   (which must all be present), then move past the string's source bytes */
+static grpc_error* reference_string(grpc_chttp2_hpack_parser* p,
+                                    const uint8_t* cur, const uint8_t* end,
+                                    const uint8_t* start, uint32_t length,
+                                    grpc_chttp2_hpack_parser_string* str) {
+  str->copied = false;
+  str->data.referenced.refcount = p->current_slice_refcount;
+  str->data.referenced.data.refcounted.bytes = const_cast<uint8_t*>(start);
+  str->data.referenced.data.refcounted.length = length;
+  grpc_slice_ref_internal(str->data.referenced);
+  if (static_cast<uint32_t>(end - cur) >= p->strlen) {
+    return parse_next(p, cur + p->strlen, end);
+  }
+  p->strgot = 0;
+  return skip_referenced_string(p, cur, end);
+}
+
 /* begin parsing a string - performs setup, calls parse_string */
 static grpc_error* begin_parse_string(grpc_chttp2_hpack_parser* p,
                                       const uint8_t* cur, const uint8_t* end,
                                       uint8_t binary,
                                       grpc_chttp2_hpack_parser_string* str) {
-  if (!p->huff && binary == NOT_BINARY &&
-      static_cast<uint32_t>(end - cur) >= p->strlen &&
-      p->current_slice_refcount != nullptr) {
-    GRPC_STATS_INC_HPACK_RECV_UNCOMPRESSED();
-    str->copied = false;
-    str->data.referenced.refcount = p->current_slice_refcount;
-    str->data.referenced.data.refcounted.bytes = const_cast<uint8_t*>(cur);
-    str->data.referenced.data.refcounted.length = p->strlen;
-    grpc_slice_ref_internal(str->data.referenced);
-    return parse_next(p, cur + p->strlen, end);
+  /* strings that appear verbatim in the slice being parsed are referenced
+     from it instead of copied: plain strings, and true-binary values (whose
+     payload follows a leading zero byte) */
+  if (!p->huff && p->current_slice_refcount != nullptr &&
+      static_cast<uint32_t>(p->current_slice_end - cur) >= p->strlen) {
+    if (binary == NOT_BINARY) {
+      GRPC_STATS_INC_HPACK_RECV_UNCOMPRESSED();
+      return reference_string(p, cur, end, cur, p->strlen, str);
+    }
+    if (p->strlen > 0 && *cur == 0) {
+      GRPC_STATS_INC_HPACK_RECV_BINARY();
+      return reference_string(p, cur, end, cur + 1, p->strlen - 1, str);
+    }
   }
   p->strgot = 0;
   str->copied = true;
@@ -1649,6 +1693,7 @@ grpc_error* grpc_chttp2_hpack_parser_parse(grpc_chttp2_hpack_parser* p,
   p->current_slice_refcount = slice.refcount;
   const uint8_t* start = GRPC_SLICE_START_PTR(slice);
   const uint8_t* end = GRPC_SLICE_END_PTR(slice);
+  p->current_slice_end = end;
   grpc_error* error = GRPC_ERROR_NONE;
   while (start != end && error == GRPC_ERROR_NONE) {
     const uint8_t* target = start + GPR_MIN(MAX_PARSE_LENGTH, end - start);
@@ -1656,6 +1701,7 @@ grpc_error* grpc_chttp2_hpack_parser_parse(grpc_chttp2_hpack_parser* p,
     start = target;
   }
   p->current_slice_refcount = nullptr;
+  p->current_slice_end = nullptr;
   return error;
 }
 
@@ -58,6 +58,9 @@ struct grpc_chttp2_hpack_parser {
   grpc_chttp2_hpack_parser_state after_prioritization;
   /* the refcount of the slice that we're currently parsing */
   grpc_slice_refcount* current_slice_refcount;
+  /* the end of the slice that we're currently parsing (parse states only see
+     up to MAX_PARSE_LENGTH bytes of it at a time) */
+  const uint8_t* current_slice_end;
   /* the value we're currently parsing */
   union {
     uint32_t* value;
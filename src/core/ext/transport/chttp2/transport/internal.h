@@ -316,6 +316,7 @@ struct grpc_chttp2_transport {
   grpc_chttp2_stream_map stream_map;
 
   grpc_closure write_action_begin_locked;
+  grpc_closure write_action_uncork;
   grpc_closure write_action;
   grpc_closure write_action_end_locked;
 
@@ -351,6 +352,15 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /** should small slices in outbuf be coalesced before being written? */
+  bool coalesce_writes = false;
+  /** max DATA bytes framed for one stream per scheduling turn (0 = no limit)
+   */
+  uint32_t write_quantum_bytes = 0;
+  /** should an idle transport defer starting a write until the ExecCtx that
+      initiated it has run out of other work? */
+  bool cork_writes = false;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error* goaway_error = GRPC_ERROR_NONE;
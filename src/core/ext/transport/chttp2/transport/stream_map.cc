@@ -20,158 +20,172 @@
 
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include "absl/container/inlined_vector.h"
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
-void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
-                                 size_t initial_capacity) {
-  GPR_DEBUG_ASSERT(initial_capacity > 1);
-  map->keys =
-      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * initial_capacity));
-  map->values =
-      static_cast<void**>(gpr_malloc(sizeof(void*) * initial_capacity));
-  map->count = 0;
-  map->free = 0;
-  map->capacity = initial_capacity;
+/* keep the table at most 3/4 full so that probe sequences stay short */
+static bool needs_grow(size_t count, size_t capacity) {
+  return (count + 1) * 4 > capacity * 3;
 }
 
-void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
-  gpr_free(map->keys);
-  gpr_free(map->values);
+/* Fibonacci hashing: spreads runs of consecutive (or equally spaced) stream
+   ids evenly over the table */
+static size_t home_slot(uint32_t key, size_t capacity) {
+  const uint32_t h = key * 0x9E3779B9u;
+  return static_cast<size_t>(h ^ (h >> 16)) & (capacity - 1);
 }
 
-static size_t compact(uint32_t* keys, void** values, size_t count) {
-  size_t i, out;
+static void alloc_table(grpc_chttp2_stream_map* map, size_t capacity) {
+  map->keys = static_cast<uint32_t*>(gpr_zalloc(sizeof(uint32_t) * capacity));
+  map->values = static_cast<void**>(gpr_malloc(sizeof(void*) * capacity));
+  map->capacity = capacity;
+}
 
-  for (i = 0, out = 0; i < count; i++) {
-    if (values[i]) {
-      keys[out] = keys[i];
-      values[out] = values[i];
-      out++;
-    }
+/* insert a key known not to be present; the table must have room */
+static void insert(grpc_chttp2_stream_map* map, uint32_t key, void* value) {
+  const size_t mask = map->capacity - 1;
+  size_t i = home_slot(key, map->capacity);
+  while (map->keys[i] != 0) {
+    i = (i + 1) & mask;
   }
-
-  return out;
+  map->keys[i] = key;
+  map->values[i] = value;
 }
 
-void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
-                                void* value) {
-  size_t count = map->count;
-  size_t capacity = map->capacity;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-
-  // The first assertion ensures that the table is monotonically increasing.
-  GPR_ASSERT(count == 0 || keys[count - 1] < key);
-  GPR_DEBUG_ASSERT(value);
-  // Asserting that the key is not already in the map can be a debug assertion.
-  // Why: we're already checking that the map elements are monotonically
-  // increasing. If we re-add a key, i.e. if the key is already present, then
-  // either it is the most recently added key in the map (in which case the
-  // first assertion fails due to key == last_key) or there is a more recently
-  // added (larger) key at the end of the map: in which case the first assertion
-  // still fails due to key < last_key.
-  GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
-
-  if (count == capacity) {
-    if (map->free > capacity / 4) {
-      count = compact(keys, values, count);
-      map->free = 0;
-    } else {
-      /* resize when less than 25% of the table is free, because compaction
-         won't help much */
-      map->capacity = capacity = 2 * capacity;
-      map->keys = keys = static_cast<uint32_t*>(
-          gpr_realloc(keys, capacity * sizeof(uint32_t)));
-      map->values = values =
-          static_cast<void**>(gpr_realloc(values, capacity * sizeof(void*)));
+static void grow(grpc_chttp2_stream_map* map) {
+  uint32_t* old_keys = map->keys;
+  void** old_values = map->values;
+  const size_t old_capacity = map->capacity;
+  alloc_table(map, 2 * old_capacity);
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_keys[i] != 0) {
+      insert(map, old_keys[i], old_values[i]);
     }
   }
+  gpr_free(old_keys);
+  gpr_free(old_values);
+}
 
-  keys[count] = key;
-  values[count] = value;
-  map->count = count + 1;
+/* returns the slot holding key, or capacity if it is not present */
+static size_t find_slot(grpc_chttp2_stream_map* map, uint32_t key) {
+  const size_t mask = map->capacity - 1;
+  size_t i = home_slot(key, map->capacity);
+  for (;;) {
+    const uint32_t k = map->keys[i];
+    if (k == key) return i;
+    if (k == 0) return map->capacity;
+    i = (i + 1) & mask;
+  }
 }
 
-template <bool strict_find>
-static void** find(grpc_chttp2_stream_map* map, uint32_t key) {
-  size_t min_idx = 0;
-  size_t max_idx = map->count;
-  size_t mid_idx;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-  uint32_t mid_key;
-
-  GPR_DEBUG_ASSERT(!strict_find || max_idx > 0);
-  if (!strict_find && max_idx == 0) return nullptr;
-
-  while (min_idx < max_idx) {
-    /* find the midpoint, avoiding overflow */
-    mid_idx = min_idx + ((max_idx - min_idx) / 2);
-    mid_key = keys[mid_idx];
-
-    if (mid_key < key) {
-      min_idx = mid_idx + 1;
-    } else if (mid_key > key) {
-      max_idx = mid_idx;
-    } else /* mid_key == key */
-    {
-      return &values[mid_idx];
-    }
+void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
+                                 size_t initial_capacity) {
+  GPR_DEBUG_ASSERT(initial_capacity > 1);
+  size_t capacity = 2;
+  while (capacity < initial_capacity) {
+    capacity *= 2;
   }
+  alloc_table(map, capacity);
+  map->count = 0;
+  map->max_key = 0;
+}
+
+void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
+  gpr_free(map->keys);
+  gpr_free(map->values);
+}
 
-  GPR_DEBUG_ASSERT(!strict_find);
-  return nullptr;
+void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
+                                void* value) {
+  // The first assertion ensures that keys are monotonically increasing, which
+  // also guarantees that the key is not already in the map.
+  GPR_ASSERT(key > map->max_key);
+  GPR_DEBUG_ASSERT(value);
+  map->max_key = key;
+  if (needs_grow(map->count, map->capacity)) {
+    grow(map);
+  }
+  insert(map, key, value);
+  map->count++;
 }
 
 void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<true>(map, key);
-  GPR_DEBUG_ASSERT(pvalue != nullptr);
-  void* out = *pvalue;
+  size_t i = find_slot(map, key);
+  GPR_DEBUG_ASSERT(i != map->capacity);
+  if (i == map->capacity) return nullptr;
+  void* out = map->values[i];
   GPR_DEBUG_ASSERT(out != nullptr);
-  *pvalue = nullptr;
-  map->free++;
-  /* recognize complete emptyness and ensure we can skip
-     defragmentation later */
-  if (map->free == map->count) {
-    map->free = map->count = 0;
+  /* backward shift deletion: pull later members of the probe cluster into
+     the hole while doing so keeps them reachable from their home slot */
+  const size_t mask = map->capacity - 1;
+  size_t j = i;
+  for (;;) {
+    j = (j + 1) & mask;
+    const uint32_t k = map->keys[j];
+    if (k == 0) break;
+    const size_t home = home_slot(k, map->capacity);
+    /* the entry at j may move to i iff i lies cyclically in [home, j) */
+    const bool movable = (i <= j) ? (home <= i || home > j)
+                                  : (home <= i && home > j);
+    if (movable) {
+      map->keys[i] = k;
+      map->values[i] = map->values[j];
+      i = j;
+    }
   }
+  map->keys[i] = 0;
+  map->count--;
   GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
   return out;
 }
 
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<false>(map, key);
-  return pvalue != nullptr ? *pvalue : nullptr;
+  if (key == 0) return nullptr;
+  size_t i = find_slot(map, key);
+  return i != map->capacity ? map->values[i] : nullptr;
 }
 
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map) {
-  return map->count - map->free;
+  return map->count;
 }
 
 void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map) {
-  if (map->count == map->free) {
+  if (map->count == 0) {
     return nullptr;
   }
-  if (map->free != 0) {
-    map->count = compact(map->keys, map->values, map->count);
-    map->free = 0;
-    GPR_ASSERT(map->count > 0);
+  const size_t mask = map->capacity - 1;
+  size_t i = static_cast<size_t>(rand()) & mask;
+  while (map->keys[i] == 0) {
+    i = (i + 1) & mask;
   }
-  return map->values[(static_cast<size_t>(rand())) % map->count];
+  return map->values[i];
 }
 
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
                                      void* user_data) {
-  size_t i;
-
-  for (i = 0; i < map->count; i++) {
-    if (map->values[i]) {
-      f(user_data, map->keys[i], map->values[i]);
+  /* snapshot the keys first: callbacks are allowed to delete entries, which
+     shifts members of the table around */
+  absl::InlinedVector<uint32_t, 16> keys;
+  keys.reserve(map->count);
+  for (size_t i = 0; i < map->capacity; i++) {
+    if (map->keys[i] != 0) {
+      keys.push_back(map->keys[i]);
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  for (uint32_t key : keys) {
+    void* value = grpc_chttp2_stream_map_find(map, key);
+    if (value != nullptr) {
+      f(user_data, key, value);
     }
   }
 }
@@ -25,23 +25,27 @@
 
 /* Data structure to map a uint32_t to a data object (represented by a void*)
 
-   Represented as a sorted array of keys, and a corresponding array of values.
-   Lookups are performed with binary search.
+   Represented as an open-addressing hash table with linear probing: a power
+   of two sized array of keys, and a corresponding array of values. A key of
+   zero marks an empty slot (stream id 0 is the connection itself and is never
+   stored). Lookups and deletes are O(1) on average. Deletes use backward
+   shifting, so there are no tombstones and the table never needs compacting.
    Adds are restricted to strictly higher keys than previously seen (this is
    guaranteed by http2). */
 struct grpc_chttp2_stream_map {
   uint32_t* keys;
   void** values;
   size_t count;
-  size_t free;
   size_t capacity;
+  /* largest key ever added: keys must be added in increasing order */
+  uint32_t max_key;
 };
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity);
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map);
 
 /* Add a new key: given http2 semantics, new keys must always be greater than
-   existing keys - this is asserted */
+   existing keys - this is asserted in debug builds */
 void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
                                 void* value);
 
@@ -58,7 +62,8 @@ void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map);
 /* How many (populated) entries are in the stream map? */
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map);
 
-/* Callback on each stream */
+/* Callback on each stream, in increasing key order. The callback may delete
+   the entry it is called for. */
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
@@ -23,6 +23,7 @@
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 
 #include <limits.h>
+#include <string.h>
 
 #include <grpc/support/log.h>
 
@@ -185,10 +186,24 @@ static void report_stall(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 }
 
 /* How many bytes would we like to put on the wire during a single syscall */
-static uint32_t target_write_size(grpc_chttp2_transport* /*t*/) {
-  return 1024 * 1024;
+static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  return t->flow_control->target_write_size();
 }
 
+/* Largest DATA frame we send: the peer's limit, further capped by what flow
+   control thinks suits the link */
+static uint32_t max_data_frame_size(grpc_chttp2_transport* t) {
+  return GPR_MIN(
+      t->settings[GRPC_PEER_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
+      t->flow_control->target_frame_size());
+}
+
+/* When write coalescing is enabled, slices shorter than this are candidates to
+   be copied into a shared slice rather than written by reference */
+static const size_t kMaxCoalescedSourceSliceSize = 1024;
+/* Upper bound on the size of a single slice produced by coalescing */
+static const size_t kMaxCoalescedSliceSize = 16384;
+
 // Returns true if initial_metadata contains only default headers.
 static bool is_default_initial_metadata(grpc_metadata_batch* initial_metadata) {
   return initial_metadata->list.default_count == initial_metadata->list.count;
@@ -295,6 +310,46 @@ class WriteContext {
 
   void NoteScheduledResults() { result_.early_results_scheduled = true; }
 
+  // Rebuilds outbuf so that each run of small slices (frame headers, window
+  // updates, pings, short messages...) is replaced by a single pre-sized
+  // slice holding a copy of their bytes. Larger slices are moved across
+  // untouched, so payload data is never copied twice.
+  void CoalesceOutbuf() {
+    if (!t_->coalesce_writes || t_->outbuf.count < 2) return;
+    GPR_TIMER_SCOPE("grpc_chttp2_coalesce_outbuf", 0);
+    grpc_slice_buffer coalesced;
+    grpc_slice_buffer_init(&coalesced);
+    while (t_->outbuf.count > 0) {
+      size_t run_count = 0;
+      size_t run_bytes = 0;
+      while (run_count < t_->outbuf.count) {
+        const size_t len = GRPC_SLICE_LENGTH(t_->outbuf.slices[run_count]);
+        if (len >= kMaxCoalescedSourceSliceSize ||
+            run_bytes + len > kMaxCoalescedSliceSize) {
+          break;
+        }
+        run_bytes += len;
+        ++run_count;
+      }
+      if (run_count < 2) {
+        grpc_slice_buffer_add(&coalesced,
+                              grpc_slice_buffer_take_first(&t_->outbuf));
+        continue;
+      }
+      grpc_slice dst = GRPC_SLICE_MALLOC(run_bytes);
+      uint8_t* p = GRPC_SLICE_START_PTR(dst);
+      for (size_t i = 0; i < run_count; ++i) {
+        grpc_slice src = grpc_slice_buffer_take_first(&t_->outbuf);
+        memcpy(p, GRPC_SLICE_START_PTR(src), GRPC_SLICE_LENGTH(src));
+        p += GRPC_SLICE_LENGTH(src);
+        grpc_slice_unref_internal(src);
+      }
+      grpc_slice_buffer_add(&coalesced, dst);
+    }
+    grpc_slice_buffer_swap(&coalesced, &t_->outbuf);
+    grpc_slice_buffer_destroy_internal(&coalesced);
+  }
+
   grpc_chttp2_transport* transport() const { return t_; }
 
   grpc_chttp2_begin_write_result Result() {
@@ -321,7 +376,10 @@ class DataSendContext {
       : write_context_(write_context),
         t_(t),
         s_(s),
-        sending_bytes_before_(s_->sending_bytes) {}
+        sending_bytes_before_(s_->sending_bytes),
+        quantum_remaining_(t->write_quantum_bytes == 0
+                               ? UINT32_MAX
+                               : t->write_quantum_bytes) {}
 
   uint32_t stream_remote_window() const {
     return static_cast<uint32_t> GPR_MAX(
@@ -332,7 +390,7 @@ class DataSendContext {
 
   uint32_t max_outgoing() const {
     return static_cast<uint32_t> GPR_MIN(
-        t_->settings[GRPC_PEER_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
+        GPR_MIN(max_data_frame_size(t_), quantum_remaining_),
         GPR_MIN(stream_remote_window(), t_->flow_control->remote_window()));
   }
 
@@ -349,6 +407,7 @@ class DataSendContext {
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     s_->flow_control->SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    quantum_remaining_ -= send_bytes;
   }
 
   void FlushCompressedBytes() {
@@ -383,6 +442,7 @@ class DataSendContext {
     grpc_chttp2_encode_data(s_->id, &s_->compressed_data_buffer, send_bytes,
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     s_->flow_control->SentData(send_bytes);
+    quantum_remaining_ -= send_bytes;
     if (s_->compressed_data_buffer.length == 0) {
       s_->sending_bytes += s_->uncompressed_data_size;
     }
@@ -422,6 +482,8 @@ class DataSendContext {
   grpc_chttp2_transport* t_;
   grpc_chttp2_stream* s_;
   const size_t sending_bytes_before_;
+  // DATA bytes this stream may still frame during the current scheduling turn
+  uint32_t quantum_remaining_;
   bool is_last_frame_ = false;
 };
 
@@ -676,6 +738,8 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   maybe_initiate_ping(t);
 
+  ctx.CoalesceOutbuf();
+
   return ctx.Result();
 }
 
@@ -494,6 +494,39 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = std::to_string(keepalives_sent);
   }
+  Json::Array options;
+  int64_t target_frame_size = target_frame_size_.Load(MemoryOrder::RELAXED);
+  if (target_frame_size != 0) {
+    options.push_back(Json::Object{
+        {"name", "grpc.http2.target_frame_size"},
+        {"value", std::to_string(target_frame_size)},
+    });
+  }
+  int64_t target_write_size = target_write_size_.Load(MemoryOrder::RELAXED);
+  if (target_write_size != 0) {
+    options.push_back(Json::Object{
+        {"name", "grpc.http2.target_write_size"},
+        {"value", std::to_string(target_write_size)},
+    });
+  }
+  int64_t smoothed_rtt_micros =
+      smoothed_rtt_micros_.Load(MemoryOrder::RELAXED);
+  if (smoothed_rtt_micros != 0) {
+    options.push_back(Json::Object{
+        {"name", "grpc.http2.smoothed_rtt_us"},
+        {"value", std::to_string(smoothed_rtt_micros)},
+    });
+  }
+  int64_t bdp_bytes = bdp_bytes_.Load(MemoryOrder::RELAXED);
+  if (bdp_bytes != 0) {
+    options.push_back(Json::Object{
+        {"name", "grpc.http2.bdp_estimate"},
+        {"value", std::to_string(bdp_bytes)},
+    });
+  }
+  if (!options.empty()) {
+    data["option"] = std::move(options);
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref",
@@ -298,6 +298,22 @@ class SocketNode : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.FetchAdd(1, MemoryOrder::RELAXED);
   }
+  // Records the outgoing frame size and bytes-per-write the transport picked
+  // for this connection.
+  void RecordWriteSizing(int64_t target_frame_size, int64_t target_write_size) {
+    target_frame_size_.Store(target_frame_size, MemoryOrder::RELAXED);
+    target_write_size_.Store(target_write_size, MemoryOrder::RELAXED);
+  }
+  // Records the transport's latest smoothed round trip time and bandwidth
+  // delay product estimates for this connection.
+  void RecordNetworkEstimates(int64_t smoothed_rtt_micros, int64_t bdp_bytes) {
+    smoothed_rtt_micros_.Store(smoothed_rtt_micros, MemoryOrder::RELAXED);
+    bdp_bytes_.Store(bdp_bytes, MemoryOrder::RELAXED);
+  }
+  int64_t smoothed_rtt_micros() {
+    return smoothed_rtt_micros_.Load(MemoryOrder::RELAXED);
+  }
+  int64_t bdp_bytes() { return bdp_bytes_.Load(MemoryOrder::RELAXED); }
 
   const std::string& remote() { return remote_; }
 
@@ -308,6 +324,10 @@ class SocketNode : public BaseNode {
   Atomic<int64_t> messages_sent_{0};
   Atomic<int64_t> messages_received_{0};
   Atomic<int64_t> keepalives_sent_{0};
+  Atomic<int64_t> target_frame_size_{0};
+  Atomic<int64_t> target_write_size_{0};
+  Atomic<int64_t> smoothed_rtt_micros_{0};
+  Atomic<int64_t> bdp_bytes_{0};
   Atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
   Atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   Atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
@@ -47,6 +47,10 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "syscall_read",
     "tcp_backup_pollers_created",
     "tcp_backup_poller_polls",
+    "tcp_zerocopy_sends",
+    "tcp_zerocopy_fallbacks",
+    "tcp_server_accepts",
+    "tcp_server_accept_yields",
     "http2_op_batches",
     "http2_op_cancel",
     "http2_op_send_initial_metadata",
@@ -119,6 +123,7 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "executor_wakeup_initiated",
     "executor_queue_drained",
     "executor_push_retries",
+    "executor_queue_stolen",
     "server_requested_calls",
     "server_slowpath_requests_queued",
     "cq_ev_queue_trylock_failures",
@@ -156,6 +161,10 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of times a backup poller has been created (this can be expensive)",
     "Number of polls performed on the backup poller",
+    "Number of TCP writes sent with MSG_ZEROCOPY",
+    "Number of TCP zerocopy writes whose data ended up being copied",
+    "Number of connections accepted by TCP server listeners",
+    "Number of times a TCP server listener yielded with a backlog pending",
     "Number of batches received by HTTP2 transport",
     "Number of cancelations received by HTTP2 transport",
     "Number of batches containing send initial metadata",
@@ -242,6 +251,7 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of times an executor queue was drained",
     "Number of times we raced and were forced to retry pushing a closure to "
     "the executor",
+    "Number of times an idle executor thread took over the queue of a busy one",
     "How many calls were requested (not necessarily received) by the server",
     "How many times was the server slow path taken (indicates too few "
     "outstanding requests)",
@@ -48,6 +48,10 @@ typedef enum {
   GRPC_STATS_COUNTER_SYSCALL_READ,
   GRPC_STATS_COUNTER_TCP_BACKUP_POLLERS_CREATED,
   GRPC_STATS_COUNTER_TCP_BACKUP_POLLER_POLLS,
+  GRPC_STATS_COUNTER_TCP_ZEROCOPY_SENDS,
+  GRPC_STATS_COUNTER_TCP_ZEROCOPY_FALLBACKS,
+  GRPC_STATS_COUNTER_TCP_SERVER_ACCEPTS,
+  GRPC_STATS_COUNTER_TCP_SERVER_ACCEPT_YIELDS,
   GRPC_STATS_COUNTER_HTTP2_OP_BATCHES,
   GRPC_STATS_COUNTER_HTTP2_OP_CANCEL,
   GRPC_STATS_COUNTER_HTTP2_OP_SEND_INITIAL_METADATA,
@@ -120,6 +124,7 @@ typedef enum {
   GRPC_STATS_COUNTER_EXECUTOR_WAKEUP_INITIATED,
   GRPC_STATS_COUNTER_EXECUTOR_QUEUE_DRAINED,
   GRPC_STATS_COUNTER_EXECUTOR_PUSH_RETRIES,
+  GRPC_STATS_COUNTER_EXECUTOR_QUEUE_STOLEN,
   GRPC_STATS_COUNTER_SERVER_REQUESTED_CALLS,
   GRPC_STATS_COUNTER_SERVER_SLOWPATH_REQUESTS_QUEUED,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_FAILURES,
@@ -219,6 +224,14 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_BACKUP_POLLERS_CREATED)
 #define GRPC_STATS_INC_TCP_BACKUP_POLLER_POLLS() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_BACKUP_POLLER_POLLS)
+#define GRPC_STATS_INC_TCP_ZEROCOPY_SENDS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_ZEROCOPY_SENDS)
+#define GRPC_STATS_INC_TCP_ZEROCOPY_FALLBACKS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_ZEROCOPY_FALLBACKS)
+#define GRPC_STATS_INC_TCP_SERVER_ACCEPTS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_SERVER_ACCEPTS)
+#define GRPC_STATS_INC_TCP_SERVER_ACCEPT_YIELDS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_SERVER_ACCEPT_YIELDS)
 #define GRPC_STATS_INC_HTTP2_OP_BATCHES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HTTP2_OP_BATCHES)
 #define GRPC_STATS_INC_HTTP2_OP_CANCEL() \
@@ -385,6 +398,8 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_QUEUE_DRAINED)
 #define GRPC_STATS_INC_EXECUTOR_PUSH_RETRIES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_PUSH_RETRIES)
+#define GRPC_STATS_INC_EXECUTOR_QUEUE_STOLEN() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_QUEUE_STOLEN)
 #define GRPC_STATS_INC_SERVER_REQUESTED_CALLS() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SERVER_REQUESTED_CALLS)
 #define GRPC_STATS_INC_SERVER_SLOWPATH_REQUESTS_QUEUED() \
@@ -456,6 +471,10 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_SYSCALL_READ()
 #define GRPC_STATS_INC_TCP_BACKUP_POLLERS_CREATED()
 #define GRPC_STATS_INC_TCP_BACKUP_POLLER_POLLS()
+#define GRPC_STATS_INC_TCP_ZEROCOPY_SENDS()
+#define GRPC_STATS_INC_TCP_ZEROCOPY_FALLBACKS()
+#define GRPC_STATS_INC_TCP_SERVER_ACCEPTS()
+#define GRPC_STATS_INC_TCP_SERVER_ACCEPT_YIELDS()
 #define GRPC_STATS_INC_HTTP2_OP_BATCHES()
 #define GRPC_STATS_INC_HTTP2_OP_CANCEL()
 #define GRPC_STATS_INC_HTTP2_OP_SEND_INITIAL_METADATA()
@@ -528,6 +547,7 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED()
 #define GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED()
 #define GRPC_STATS_INC_EXECUTOR_PUSH_RETRIES()
+#define GRPC_STATS_INC_EXECUTOR_QUEUE_STOLEN()
 #define GRPC_STATS_INC_SERVER_REQUESTED_CALLS()
 #define GRPC_STATS_INC_SERVER_SLOWPATH_REQUESTS_QUEUED()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES()
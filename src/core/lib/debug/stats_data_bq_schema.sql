@@ -19,6 +19,10 @@ syscall_write_per_iteration:FLOAT,
 syscall_read_per_iteration:FLOAT,
 tcp_backup_pollers_created_per_iteration:FLOAT,
 tcp_backup_poller_polls_per_iteration:FLOAT,
+tcp_zerocopy_sends_per_iteration:FLOAT,
+tcp_zerocopy_fallbacks_per_iteration:FLOAT,
+tcp_server_accepts_per_iteration:FLOAT,
+tcp_server_accept_yields_per_iteration:FLOAT,
 http2_op_batches_per_iteration:FLOAT,
 http2_op_cancel_per_iteration:FLOAT,
 http2_op_send_initial_metadata_per_iteration:FLOAT,
@@ -91,6 +95,7 @@ executor_scheduled_to_self_per_iteration:FLOAT,
 executor_wakeup_initiated_per_iteration:FLOAT,
 executor_queue_drained_per_iteration:FLOAT,
 executor_push_retries_per_iteration:FLOAT,
+executor_queue_stolen_per_iteration:FLOAT,
 server_requested_calls_per_iteration:FLOAT,
 server_slowpath_requests_queued_per_iteration:FLOAT,
 cq_ev_queue_trylock_failures_per_iteration:FLOAT,
@@ -52,6 +52,7 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/block_annotate.h"
 #include "src/core/lib/iomgr/ev_posix.h"
@@ -60,14 +61,32 @@
 #include "src/core/lib/iomgr/wakeup_fd_posix.h"
 #include "src/core/lib/profiling/timers.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_poll_busy_poll_us, 0,
+    "With the epoll1 engine, how long (in microseconds) a poller spins on "
+    "non-blocking epoll_wait calls before blocking. Trades CPU for wakeup "
+    "latency; 0 (the default) disables spinning.");
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_poll_epoll_max_events, 100,
+    "With the epoll1 engine, the maximum number of events fetched by each "
+    "epoll_wait call.");
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_poll_epoll_events_per_iteration, 1,
+    "With the epoll1 engine, how many of the fetched events a poller turns "
+    "into closures before handing the rest to another poller. Larger values "
+    "let one poller schedule a whole batch of readiness notifications in a "
+    "single ExecCtx.");
+
 static grpc_wakeup_fd global_wakeup_fd;
+/* grpc_poll_busy_poll_us, read once at init */
+static int32_t g_busy_poll_us;
 
 /*******************************************************************************
  * Singleton epoll set related fields
  */
 
 #define MAX_EPOLL_EVENTS 100
-#define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
+#define MAX_EPOLL_EVENTS_LIMIT 4096
 
 /* NOTE ON SYNCHRONIZATION:
  * - Fields in this struct are only modified by the designated poller. Hence
@@ -81,7 +100,14 @@ typedef struct epoll_set {
   int epfd;
 
   /* The epoll_events after the last call to epoll_wait() */
-  struct epoll_event events[MAX_EPOLL_EVENTS];
+  struct epoll_event* events;
+
+  /* Capacity of events (grpc_poll_epoll_max_events) */
+  int max_events;
+
+  /* How many events process_epoll_events() handles per call
+   * (grpc_poll_epoll_events_per_iteration) */
+  int events_per_iteration;
 
   /* The number of epoll_events after the last call to epoll_wait() */
   gpr_atm num_events;
@@ -120,6 +146,14 @@ static bool epoll_set_init() {
   }
 
   gpr_log(GPR_INFO, "grpc epoll fd: %d", g_epoll_set.epfd);
+  g_epoll_set.max_events =
+      GPR_CLAMP(GPR_GLOBAL_CONFIG_GET(grpc_poll_epoll_max_events), 1,
+                MAX_EPOLL_EVENTS_LIMIT);
+  g_epoll_set.events_per_iteration =
+      GPR_CLAMP(GPR_GLOBAL_CONFIG_GET(grpc_poll_epoll_events_per_iteration), 1,
+                g_epoll_set.max_events);
+  g_epoll_set.events = static_cast<struct epoll_event*>(
+      gpr_malloc(g_epoll_set.max_events * sizeof(*g_epoll_set.events)));
   gpr_atm_no_barrier_store(&g_epoll_set.num_events, 0);
   gpr_atm_no_barrier_store(&g_epoll_set.cursor, 0);
   return true;
@@ -131,6 +165,8 @@ static void epoll_set_shutdown() {
     close(g_epoll_set.epfd);
     g_epoll_set.epfd = -1;
   }
+  gpr_free(g_epoll_set.events);
+  g_epoll_set.events = nullptr;
 }
 
 /*******************************************************************************
@@ -518,6 +554,7 @@ static grpc_error* pollset_global_init(void) {
   gpr_tls_init(&g_current_thread_pollset);
   gpr_tls_init(&g_current_thread_worker);
   gpr_atm_no_barrier_store(&g_active_poller, 0);
+  g_busy_poll_us = GPR_MAX(GPR_GLOBAL_CONFIG_GET(grpc_poll_busy_poll_us), 0);
   global_wakeup_fd.read_fd = -1;
   grpc_error* err = grpc_wakeup_fd_init(&global_wakeup_fd);
   if (err != GRPC_ERROR_NONE) return err;
@@ -657,8 +694,8 @@ static int poll_deadline_to_millis_timeout(grpc_millis millis) {
 
 /* Process the epoll events found by do_epoll_wait() function.
    - g_epoll_set.cursor points to the index of the first event to be processed
-   - This function then processes up-to MAX_EPOLL_EVENTS_PER_ITERATION and
-     updates the g_epoll_set.cursor
+   - This function then processes up-to g_epoll_set.events_per_iteration
+     events and updates the g_epoll_set.cursor
 
    NOTE ON SYNCRHONIZATION: Similar to do_epoll_wait(), this function is only
    called by g_active_poller thread. So there is no need for synchronization
@@ -671,7 +708,7 @@ static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/) {
   long num_events = gpr_atm_acq_load(&g_epoll_set.num_events);
   long cursor = gpr_atm_acq_load(&g_epoll_set.cursor);
   for (int idx = 0;
-       (idx < MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION) && cursor != num_events;
+       (idx < g_epoll_set.events_per_iteration) && cursor != num_events;
        idx++) {
     long c = cursor++;
     struct epoll_event* ev = &g_epoll_set.events[c];
@@ -708,6 +745,28 @@ static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/) {
   return error;
 }
 
+/* Poll without blocking until something is ready, or until the busy poll
+   budget (capped by the caller's timeout) runs out. Kicks arrive through
+   global_wakeup_fd, which is in the epoll set, so they end the spin too. */
+static int busy_epoll_wait(int timeout) {
+  int64_t spin_us = g_busy_poll_us;
+  if (timeout > 0) {
+    spin_us = GPR_MIN(spin_us, static_cast<int64_t>(timeout) * GPR_US_PER_MS);
+  }
+  const gpr_timespec spin_end =
+      gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                   gpr_time_from_micros(spin_us, GPR_TIMESPAN));
+  int r;
+  do {
+    GRPC_STATS_INC_SYSCALL_POLL();
+    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events,
+                   g_epoll_set.max_events, 0);
+  } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+           gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), spin_end) < 0);
+  /* an interrupted last attempt just means nothing was found */
+  return r < 0 && errno == EINTR ? 0 : r;
+}
+
 /* Do epoll_wait and store the events in g_epoll_set.events field. This does not
    "process" any of the events yet; that is done in process_epoll_events().
    *See process_epoll_events() function for more details.
@@ -718,18 +777,28 @@ static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/) {
 static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
   GPR_TIMER_SCOPE("do_epoll_wait", 0);
 
-  int r;
+  int r = 0;
   int timeout = poll_deadline_to_millis_timeout(deadline);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_START_BLOCKING_REGION;
+  if (timeout != 0 && g_busy_poll_us > 0) {
+    r = busy_epoll_wait(timeout);
+    if (r == 0) {
+      /* spun out: block for whatever is left of the deadline */
+      grpc_core::ExecCtx::Get()->InvalidateNow();
+      timeout = poll_deadline_to_millis_timeout(deadline);
+    }
   }
-  do {
-    GRPC_STATS_INC_SYSCALL_POLL();
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_END_BLOCKING_REGION;
+  if (r == 0) {
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    do {
+      GRPC_STATS_INC_SYSCALL_POLL();
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events,
+                     g_epoll_set.max_events, timeout);
+    } while (r < 0 && errno == EINTR);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
   }
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
@@ -153,7 +153,12 @@ bool ExecCtx::Flush() {
         exec_ctx_run(c, error);
         c = next;
       }
-    } else if (!grpc_combiner_continue_exec_ctx()) {
+    } else if (grpc_combiner_continue_exec_ctx()) {
+      continue;
+    } else if (!grpc_closure_list_empty(idle_closure_list_)) {
+      closure_list_ = idle_closure_list_;
+      idle_closure_list_ = GRPC_CLOSURE_LIST_INIT;
+    } else {
       break;
     }
   }
@@ -221,4 +226,30 @@ void ExecCtx::RunList(const DebugLocation& location, grpc_closure_list* list) {
   list->head = list->tail = nullptr;
 }
 
+void ExecCtx::RunWhenIdle(const DebugLocation& location, grpc_closure* closure,
+                          grpc_error* error) {
+  (void)location;
+  if (closure == nullptr) {
+    GRPC_ERROR_UNREF(error);
+    return;
+  }
+#ifndef NDEBUG
+  if (closure->scheduled) {
+    gpr_log(GPR_ERROR,
+            "Closure already scheduled. (closure: %p, created: [%s:%d], "
+            "previously scheduled at: [%s: %d], newly scheduled at [%s: %d]",
+            closure, closure->file_created, closure->line_created,
+            closure->file_initiated, closure->line_initiated, location.file(),
+            location.line());
+    abort();
+  }
+  closure->scheduled = true;
+  closure->file_initiated = location.file();
+  closure->line_initiated = location.line();
+  closure->run = false;
+  GPR_ASSERT(closure->cb != nullptr);
+#endif
+  grpc_closure_list_append(&Get()->idle_closure_list_, closure, error);
+}
+
 }  // namespace grpc_core
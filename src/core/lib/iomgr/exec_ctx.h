@@ -160,7 +160,8 @@ class ExecCtx {
   /** Checks if there is work to be done */
   bool HasWork() {
     return combiner_data_.active_combiner != nullptr ||
-           !grpc_closure_list_empty(closure_list_);
+           !grpc_closure_list_empty(closure_list_) ||
+           !grpc_closure_list_empty(idle_closure_list_);
   }
 
   /** Flush any work that has been enqueued onto this grpc_exec_ctx.
@@ -232,6 +233,14 @@ class ExecCtx {
 
   static void RunList(const DebugLocation& location, grpc_closure_list* list);
 
+  /** Schedule \a closure to run once this ExecCtx has no other closures or
+   *  combiners left to run during Flush(). Work queued from the same call
+   *  stack (and anything it triggers) is therefore complete by the time
+   *  \a closure runs, which lets callers cork output until the end of the
+   *  current batch of work. */
+  static void RunWhenIdle(const DebugLocation& location, grpc_closure* closure,
+                          grpc_error* error);
+
  protected:
   /** Check if ready to finish. */
   virtual bool CheckReadyToFinish() { return false; }
@@ -243,6 +252,7 @@ class ExecCtx {
   /** Set exec_ctx_ to exec_ctx. */
 
   grpc_closure_list closure_list_ = GRPC_CLOSURE_LIST_INIT;
+  grpc_closure_list idle_closure_list_ = GRPC_CLOSURE_LIST_INIT;
   CombinerData combiner_data_ = {nullptr, nullptr};
   uintptr_t flags_;
 
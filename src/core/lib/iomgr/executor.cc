@@ -159,6 +159,7 @@ void Executor::SetThreading(bool threading) {
       thd_state_[i].name = name_;
       thd_state_[i].thd = grpc_core::Thread();
       thd_state_[i].elems = GRPC_CLOSURE_LIST_INIT;
+      thd_state_[i].executor = this;
     }
 
     thd_state_[0].thd =
@@ -218,17 +219,21 @@ void Executor::ThreadMain(void* arg) {
 
   grpc_core::ExecCtx exec_ctx(GRPC_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
 
-  size_t subtract_depth = 0;
   for (;;) {
-    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: step (sub_depth=%" PRIdPTR ")",
-                   ts->name, ts->id, subtract_depth);
+    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: step (depth=%" PRIdPTR ")", ts->name,
+                   ts->id, ts->depth);
 
     gpr_mu_lock(&ts->mu);
-    ts->depth -= subtract_depth;
-    // Wait for closures to be enqueued or for the executor to be shutdown
+    ts->busy = false;
+    // Wait for closures to be enqueued or for the executor to be shutdown.
+    // Before going to sleep, take over the queue of a thread that is stuck
+    // running a closure.
     while (grpc_closure_list_empty(ts->elems) && !ts->shutdown) {
       ts->queued_long_job = false;
+      if (ts->executor->StealClosuresLocked(ts)) break;
+      ts->idle = true;
       gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
+      ts->idle = false;
     }
 
     if (ts->shutdown) {
@@ -237,20 +242,69 @@ void Executor::ThreadMain(void* arg) {
       break;
     }
 
-    GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
-    grpc_closure_list closures = ts->elems;
-    ts->elems = GRPC_CLOSURE_LIST_INIT;
+    // Closures are taken one at a time so that while one of them runs, the
+    // rest of the queue stays visible to idle threads.
+    grpc_closure_list closures = GRPC_CLOSURE_LIST_INIT;
+    closures.head = closures.tail = ts->elems.head;
+    ts->elems.head = ts->elems.head->next_data.next;
+    if (ts->elems.head == nullptr) {
+      ts->elems.tail = nullptr;
+      GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
+    }
+    closures.head->next_data.next = nullptr;
+    ts->depth--;
+    ts->busy = true;
     gpr_mu_unlock(&ts->mu);
 
     EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: execute", ts->name, ts->id);
 
     grpc_core::ExecCtx::Get()->InvalidateNow();
-    subtract_depth = RunClosures(ts->name, closures);
+    RunClosures(ts->name, closures);
   }
 
   gpr_tls_set(&g_this_thread_state, reinterpret_cast<intptr_t>(nullptr));
 }
 
+bool Executor::StealClosuresLocked(ThreadState* thief) {
+  size_t cur_thread_count =
+      static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+  for (size_t i = 1; i < cur_thread_count; i++) {
+    ThreadState* victim = &thd_state_[(thief->id + i) % cur_thread_count];
+    // Only ever trylock: the thief already holds its own lock, and two idle
+    // threads may be trying to steal from each other.
+    if (!gpr_mu_trylock(&victim->mu)) continue;
+    if (victim->busy && !victim->shutdown &&
+        !grpc_closure_list_empty(victim->elems)) {
+      EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: steal %" PRIdPTR
+                     " closures from thread %" PRIdPTR,
+                     thief->name, thief->id, victim->depth, victim->id);
+      GRPC_STATS_INC_EXECUTOR_QUEUE_STOLEN();
+      grpc_closure_list_move(&victim->elems, &thief->elems);
+      thief->depth += victim->depth;
+      thief->queued_long_job = victim->queued_long_job;
+      victim->depth = 0;
+      gpr_mu_unlock(&victim->mu);
+      return true;
+    }
+    gpr_mu_unlock(&victim->mu);
+  }
+  return false;
+}
+
+void Executor::WakeIdleThread(ThreadState* busy_ts, size_t cur_thread_count) {
+  for (size_t i = 1; i < cur_thread_count; i++) {
+    ThreadState* ts = &thd_state_[(busy_ts->id + i) % cur_thread_count];
+    if (!gpr_mu_trylock(&ts->mu)) continue;
+    bool idle = ts->idle && !ts->shutdown;
+    if (idle) {
+      GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED();
+      gpr_cv_signal(&ts->cv);
+    }
+    gpr_mu_unlock(&ts->mu);
+    if (idle) return;
+  }
+}
+
 void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
                        bool is_short) {
   bool retry_push;
@@ -292,6 +346,7 @@ void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
     }
 
     ThreadState* orig_ts = ts;
+    ThreadState* steal_from = nullptr;
     bool try_new_thread = false;
 
     for (;;) {
@@ -347,6 +402,10 @@ void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
 
       grpc_closure_list_append(&ts->elems, closure, error);
 
+      // If the thread is busy running a closure, this one would have to
+      // wait behind it: let an idle thread steal the queue instead.
+      steal_from = ts->busy && !ts->shutdown ? ts : nullptr;
+
       // If we already queued more than MAX_DEPTH number of closures on this
       // thread, use this as a hint to create more threads
       ts->depth++;
@@ -359,6 +418,10 @@ void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
       break;
     }
 
+    if (steal_from != nullptr) {
+      WakeIdleThread(steal_from, cur_thread_count);
+    }
+
     if (try_new_thread && gpr_spinlock_trylock(&adding_thread_lock_)) {
       cur_thread_count = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
       if (cur_thread_count < max_threads_) {
@@ -27,6 +27,8 @@
 
 namespace grpc_core {
 
+class Executor;
+
 struct ThreadState {
   gpr_mu mu;
   size_t id;         // For debugging purposes
@@ -36,6 +38,9 @@ struct ThreadState {
   size_t depth;  // Number of closures in the closure list
   bool shutdown;
   bool queued_long_job;
+  bool busy;  // Running a closure; anything queued behind it may be stolen
+  bool idle;  // Waiting on cv for work
+  Executor* executor;
   grpc_core::Thread thd;
 };
 
@@ -107,6 +112,12 @@ class Executor {
   static size_t RunClosures(const char* executor_name, grpc_closure_list list);
   static void ThreadMain(void* arg);
 
+  // Moves the queue of some busy thread onto the (empty) queue of thief.
+  // Returns true if anything was stolen. Requires thief->mu to be held.
+  bool StealClosuresLocked(ThreadState* thief);
+  // Wakes up one idle thread so that it can steal work from busy_ts.
+  void WakeIdleThread(ThreadState* busy_ts, size_t cur_thread_count);
+
   const char* name_;
   ThreadState* thd_state_;
   size_t max_threads_;
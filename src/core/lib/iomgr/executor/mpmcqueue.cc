@@ -20,6 +20,8 @@
 
 #include "src/core/lib/iomgr/executor/mpmcqueue.h"
 
+#include <atomic>
+
 namespace grpc_core {
 
 DebugOnlyTraceFlag grpc_thread_pool_trace(false, "thread_pool");
@@ -180,4 +182,144 @@ void InfLenFIFOQueue::RemoveWaiter(Waiter* waiter) {
 
 InfLenFIFOQueue::Waiter* InfLenFIFOQueue::TopWaiter() { return waiters_.next; }
 
+static size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = 2;
+  while (result < n) result <<= 1;
+  return result;
+}
+
+BoundedMPMCQueue::BoundedMPMCQueue(size_t capacity)
+    : mask_(RoundUpToPowerOfTwo(capacity) - 1) {
+  cells_ = static_cast<Cell*>(gpr_malloc(sizeof(Cell) * (mask_ + 1)));
+  for (size_t i = 0; i <= mask_; ++i) {
+    new (&cells_[i].sequence) Atomic<size_t>(i);
+    cells_[i].content = nullptr;
+  }
+}
+
+BoundedMPMCQueue::~BoundedMPMCQueue() {
+  GPR_ASSERT(waiting_getters_.Load(MemoryOrder::RELAXED) == 0);
+  GPR_ASSERT(waiting_putters_.Load(MemoryOrder::RELAXED) == 0);
+  for (size_t i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.~Atomic<size_t>();
+  }
+  gpr_free(cells_);
+}
+
+bool BoundedMPMCQueue::Push(void* elem) {
+  size_t pos = enqueue_pos_.Load(MemoryOrder::RELAXED);
+  for (;;) {
+    Cell* cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.Load(MemoryOrder::ACQUIRE);
+    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      // The cell is free for this position: claim it.
+      if (enqueue_pos_.CompareExchangeWeak(&pos, pos + 1, MemoryOrder::RELAXED,
+                                           MemoryOrder::RELAXED)) {
+        cell->content = elem;
+        cell->sequence.Store(pos + 1, MemoryOrder::RELEASE);
+        break;
+      }
+    } else if (diff < 0) {
+      // The cell still holds the element from one lap ago: full.
+      return false;
+    } else {
+      pos = enqueue_pos_.Load(MemoryOrder::RELAXED);
+    }
+  }
+  count_.FetchAdd(1, MemoryOrder::RELAXED);
+  return true;
+}
+
+bool BoundedMPMCQueue::Pop(void** elem) {
+  size_t pos = dequeue_pos_.Load(MemoryOrder::RELAXED);
+  for (;;) {
+    Cell* cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.Load(MemoryOrder::ACQUIRE);
+    intptr_t diff =
+        static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.CompareExchangeWeak(&pos, pos + 1, MemoryOrder::RELAXED,
+                                           MemoryOrder::RELAXED)) {
+        *elem = cell->content;
+        // Hand the cell to the producer one lap ahead.
+        cell->sequence.Store(pos + mask_ + 1, MemoryOrder::RELEASE);
+        break;
+      }
+    } else if (diff < 0) {
+      // Nothing has been published at this position yet: empty.
+      return false;
+    } else {
+      pos = dequeue_pos_.Load(MemoryOrder::RELAXED);
+    }
+  }
+  count_.FetchSub(1, MemoryOrder::RELAXED);
+  return true;
+}
+
+bool BoundedMPMCQueue::TryPut(void* elem) {
+  if (!Push(elem)) return false;
+  MaybeSignal(&waiting_getters_, &not_empty_);
+  return true;
+}
+
+bool BoundedMPMCQueue::TryGet(void** elem) {
+  if (!Pop(elem)) return false;
+  MaybeSignal(&waiting_putters_, &not_full_);
+  return true;
+}
+
+void BoundedMPMCQueue::MaybeSignal(Atomic<int>* waiters, CondVar* cv) {
+  // Pairs with the fence in Put()/Get(): either the sleeper sees our update
+  // of the ring when it retries, or we see its registration here.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters->Load(MemoryOrder::RELAXED) > 0) {
+    MutexLock lock(&mu_);
+    cv->Signal();
+  }
+}
+
+void BoundedMPMCQueue::Put(void* elem) {
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (TryPut(elem)) return;
+  }
+  {
+    MutexLock lock(&mu_);
+    waiting_putters_.FetchAdd(1, MemoryOrder::RELAXED);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!Push(elem)) {
+      not_full_.Wait(&mu_);
+    }
+    waiting_putters_.FetchSub(1, MemoryOrder::RELAXED);
+  }
+  MaybeSignal(&waiting_getters_, &not_empty_);
+}
+
+void* BoundedMPMCQueue::Get(gpr_timespec* wait_time) {
+  void* elem;
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (TryGet(&elem)) return elem;
+  }
+  gpr_timespec start_time;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace) &&
+      wait_time != nullptr) {
+    start_time = gpr_now(GPR_CLOCK_MONOTONIC);
+  }
+  {
+    MutexLock lock(&mu_);
+    waiting_getters_.FetchAdd(1, MemoryOrder::RELAXED);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!Pop(&elem)) {
+      not_empty_.Wait(&mu_);
+    }
+    waiting_getters_.FetchSub(1, MemoryOrder::RELAXED);
+  }
+  MaybeSignal(&waiting_putters_, &not_full_);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace) &&
+      wait_time != nullptr) {
+    *wait_time = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start_time);
+  }
+  return elem;
+}
+
 }  // namespace grpc_core
@@ -170,6 +170,73 @@ class InfLenFIFOQueue : public MPMCQueueInterface {
   Node* AllocateNodes(int num);
 };
 
+// A fixed capacity MPMC queue based on Dmitry Vyukov's bounded ring: each
+// slot carries a sequence number, so producers and consumers only contend on
+// a CAS of the enqueue or dequeue position and never on a lock. Threads only
+// take the internal mutex to sleep when the queue is empty (Get) or full (Put)
+// and to wake such sleepers up.
+class BoundedMPMCQueue : public MPMCQueueInterface {
+ public:
+  // Creates a queue holding up to "capacity" elements, rounded up to a power
+  // of two (and at least 2).
+  explicit BoundedMPMCQueue(size_t capacity);
+
+  // Releases all resources held by the queue. No one may be blocked in Put()
+  // or Get().
+  ~BoundedMPMCQueue();
+
+  // Puts elem at the end of the queue, blocking while the queue is full.
+  void Put(void* elem) override;
+
+  // Removes the oldest element from the queue and returns it, blocking while
+  // the queue is empty. Argument wait_time is filled in with the time spent
+  // blocked when the thread_pool trace flag is on.
+  void* Get(gpr_timespec* wait_time = nullptr) override;
+
+  // Non-blocking versions of Put() and Get(). Return false if the queue was
+  // full (resp. empty).
+  bool TryPut(void* elem);
+  bool TryGet(void** elem);
+
+  // Returns (approximately, under concurrent use) the number of elements in
+  // the queue.
+  int count() const override { return count_.Load(MemoryOrder::RELAXED); }
+
+  size_t capacity() const { return mask_ + 1; }
+
+ private:
+  struct Cell {
+    Atomic<size_t> sequence;
+    void* content;
+  };
+
+  // Number of failed attempts before a blocking call goes to sleep.
+  static const int kSpinCount = 64;
+
+  // The lock-free ring operations, without waking up sleepers.
+  bool Push(void* elem);
+  bool Pop(void** elem);
+
+  // Wakes up one thread sleeping on cv if waiters says there may be one.
+  void MaybeSignal(Atomic<int>* waiters, CondVar* cv);
+
+  Cell* cells_;
+  const size_t mask_;
+  // Producer and consumer positions, on separate cache lines.
+  char pad0_[GPR_CACHELINE_SIZE];
+  Atomic<size_t> enqueue_pos_{0};
+  char pad1_[GPR_CACHELINE_SIZE];
+  Atomic<size_t> dequeue_pos_{0};
+  char pad2_[GPR_CACHELINE_SIZE];
+  Atomic<int> count_{0};
+
+  Mutex mu_;
+  CondVar not_empty_;
+  CondVar not_full_;
+  Atomic<int> waiting_getters_{0};
+  Atomic<int> waiting_putters_{0};
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_IOMGR_EXECUTOR_MPMCQUEUE_H */
@@ -180,12 +180,19 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
+  // Auto-tuning never raises the threshold past this many bytes.
+  static constexpr size_t kMaxAutoTuneThreshold = 1024 * 1024;  // 1MB
+  // Number of zerocopy outcomes observed before the threshold is re-evaluated.
+  static constexpr uint32_t kAutoTuneWindow = 32;
 
   TcpZerocopySendCtx(int max_sends = kDefaultMaxSends,
-                     size_t send_bytes_threshold = kDefaultSendBytesThreshold)
+                     size_t send_bytes_threshold = kDefaultSendBytesThreshold,
+                     bool auto_tune = false)
       : max_sends_(max_sends),
         free_send_records_size_(max_sends),
-        threshold_bytes_(send_bytes_threshold) {
+        threshold_bytes_(send_bytes_threshold),
+        base_threshold_bytes_(send_bytes_threshold),
+        auto_tune_(auto_tune) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
         gpr_malloc(max_sends * sizeof(*send_records_)));
     free_send_records_ = static_cast<TcpZerocopySendRecord**>(
@@ -304,7 +311,35 @@ class TcpZerocopySendCtx {
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
   // zerocopy is not useful for small transfers.
-  size_t threshold_bytes() const { return threshold_bytes_; }
+  size_t threshold_bytes() const {
+    return threshold_bytes_.Load(MemoryOrder::RELAXED);
+  }
+
+  // With auto-tuning enabled, account for |count| zerocopy outcomes: either
+  // sends that went out without copying, or (if |copied|) sends whose data was
+  // copied regardless - by the kernel, or by us because every send record was
+  // still awaiting its completion. Every kAutoTuneWindow outcomes, the
+  // threshold doubles if more than a quarter of them were copies, and decays
+  // back towards the configured value if none were.
+  void NoteOutcome(uint32_t count, bool copied) {
+    if (!auto_tune_) return;
+    MutexLock guard(&lock_);
+    window_outcomes_ += count;
+    if (copied) window_copied_ += count;
+    if (window_outcomes_ < kAutoTuneWindow) return;
+    size_t threshold = threshold_bytes_.Load(MemoryOrder::RELAXED);
+    if (window_copied_ * 4 > window_outcomes_) {
+      if (threshold < kMaxAutoTuneThreshold) {
+        threshold = GPR_MIN(GPR_MAX(threshold * 2, kDefaultSendBytesThreshold),
+                            kMaxAutoTuneThreshold);
+      }
+    } else if (window_copied_ == 0) {
+      threshold = GPR_MAX(threshold / 2, base_threshold_bytes_);
+    }
+    threshold_bytes_.Store(threshold, MemoryOrder::RELAXED);
+    window_outcomes_ = 0;
+    window_copied_ = 0;
+  }
 
  private:
   TcpZerocopySendRecord* ReleaseSendRecordLocked(uint32_t seq) {
@@ -340,7 +375,11 @@ class TcpZerocopySendCtx {
   uint32_t last_send_ = 0;
   Atomic<bool> shutdown_;
   bool enabled_ = false;
-  size_t threshold_bytes_ = kDefaultSendBytesThreshold;
+  Atomic<size_t> threshold_bytes_;
+  const size_t base_threshold_bytes_;
+  const bool auto_tune_;
+  uint32_t window_outcomes_ = 0;
+  uint32_t window_copied_ = 0;
   std::unordered_map<uint32_t, TcpZerocopySendRecord*> ctx_lookup_;
   bool memory_limited_ = false;
 };
@@ -352,8 +391,8 @@ using grpc_core::TcpZerocopySendRecord;
 
 namespace {
 struct grpc_tcp {
-  grpc_tcp(int max_sends, size_t send_bytes_threshold)
-      : tcp_zerocopy_send_ctx(max_sends, send_bytes_threshold) {}
+  grpc_tcp(int max_sends, size_t send_bytes_threshold, bool auto_tune)
+      : tcp_zerocopy_send_ctx(max_sends, send_bytes_threshold, auto_tune) {}
   grpc_endpoint base;
   grpc_fd* em_fd;
   int fd;
@@ -374,6 +413,8 @@ struct grpc_tcp {
   grpc_slice_buffer* incoming_buffer;
   int inq;          /* bytes pending on the socket from the last read. */
   bool inq_capable; /* cache whether kernel supports inq */
+  bool inq_exact;   /* whether inq was reported by the kernel (TCP_CM_INQ)
+                       rather than assumed */
 
   grpc_slice_buffer* outgoing_buffer;
   /* byte within outgoing_buffer->slices[0] to write next */
@@ -586,8 +627,12 @@ static void finish_estimate(grpc_tcp* tcp) {
 static size_t get_target_read_size(grpc_tcp* tcp) {
   grpc_resource_quota* rq = grpc_resource_user_quota(tcp->resource_user);
   double pressure = grpc_resource_quota_get_memory_pressure(rq);
-  double target =
-      tcp->target_length * (pressure > 0.8 ? (1.0 - pressure) / 0.2 : 1.0);
+  /* when the kernel told us how many bytes are waiting, size the read to
+     them rather than to the running estimate */
+  double target = tcp->inq_exact && tcp->inq > 0
+                      ? static_cast<double>(tcp->inq)
+                      : tcp->target_length;
+  target *= pressure > 0.8 ? (1.0 - pressure) / 0.2 : 1.0;
   size_t sz = ((static_cast<size_t> GPR_CLAMP(target, tcp->min_read_chunk_size,
                                               tcp->max_read_chunk_size)) +
                255) &
@@ -726,6 +771,7 @@ static void tcp_do_read(grpc_tcp* tcp) {
      * kernel, we will update this value, otherwise, we have to assume there is
      * always something to read until we get EAGAIN. */
     tcp->inq = 1;
+    tcp->inq_exact = false;
 
     msg.msg_name = nullptr;
     msg.msg_namelen = 0;
@@ -753,6 +799,7 @@ static void tcp_do_read(grpc_tcp* tcp) {
      * bytes to the upper layer. */
     if (read_bytes <= 0 && total_read_bytes > 0) {
       tcp->inq = 1;
+      tcp->inq_exact = false;
       break;
     }
 
@@ -799,6 +846,7 @@ static void tcp_do_read(grpc_tcp* tcp) {
         if (cmsg->cmsg_level == SOL_TCP && cmsg->cmsg_type == TCP_CM_INQ &&
             cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
           tcp->inq = *reinterpret_cast<int*>(CMSG_DATA(cmsg));
+          tcp->inq_exact = true;
           break;
         }
       }
@@ -975,7 +1023,11 @@ static TcpZerocopySendRecord* tcp_get_send_zerocopy_record(
       process_errors(tcp);
       zerocopy_send_record = tcp->tcp_zerocopy_send_ctx.GetSendRecord();
     }
-    if (zerocopy_send_record != nullptr) {
+    if (zerocopy_send_record == nullptr) {
+      GRPC_STATS_INC_TCP_ZEROCOPY_FALLBACKS();
+      tcp->tcp_zerocopy_send_ctx.NoteOutcome(1, true);
+    } else {
+      GRPC_STATS_INC_TCP_ZEROCOPY_SENDS();
       zerocopy_send_record->PrepareForSends(buf);
       GPR_DEBUG_ASSERT(buf->count == 0);
       GPR_DEBUG_ASSERT(buf->length == 0);
@@ -1049,6 +1101,11 @@ static void process_zerocopy(grpc_tcp* tcp, struct cmsghdr* cmsg) {
   GPR_DEBUG_ASSERT(serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY);
   const uint32_t lo = serr->ee_info;
   const uint32_t hi = serr->ee_data;
+  const bool copied = (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+  if (copied) {
+    GRPC_STATS_INC_TCP_ZEROCOPY_FALLBACKS();
+  }
+  tcp->tcp_zerocopy_send_ctx.NoteOutcome(hi - lo + 1, copied);
   for (uint32_t seq = lo; seq <= hi; ++seq) {
     // TODO(arjunroy): It's likely that lo and hi refer to zerocopy sequence
     // numbers that are generated by a single call to grpc_endpoint_write; ie.
@@ -1703,6 +1760,7 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
       grpc_core::TcpZerocopySendCtx::kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simult_sends =
       grpc_core::TcpZerocopySendCtx::kDefaultMaxSends;
+  bool tcp_tx_zerocopy_auto_tune = false;
   grpc_resource_quota* resource_quota = grpc_resource_quota_create(nullptr);
   if (channel_args != nullptr) {
     for (size_t i = 0; i < channel_args->num_args; i++) {
@@ -1744,6 +1802,10 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
             grpc_core::TcpZerocopySendCtx::kDefaultMaxSends, 0, INT_MAX};
         tcp_tx_zerocopy_max_simult_sends =
             grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_ZEROCOPY_AUTO_TUNE)) {
+        tcp_tx_zerocopy_auto_tune =
+            grpc_channel_arg_get_bool(&channel_args->args[i], false);
       }
     }
   }
@@ -1755,7 +1817,8 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                                   tcp_max_read_chunk_size);
 
   grpc_tcp* tcp = new grpc_tcp(tcp_tx_zerocopy_max_simult_sends,
-                               tcp_tx_zerocopy_send_bytes_thresh);
+                               tcp_tx_zerocopy_send_bytes_thresh,
+                               tcp_tx_zerocopy_auto_tune);
   tcp->base.vtable = &vtable;
   tcp->peer_string = peer_string;
   tcp->fd = grpc_fd_wrapped_fd(em_fd);
@@ -1822,6 +1885,7 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   }
   /* Always assume there is something on the queue to read. */
   tcp->inq = 1;
+  tcp->inq_exact = false;
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(tcp->fd, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
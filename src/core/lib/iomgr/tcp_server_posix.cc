@@ -43,11 +43,13 @@
 #include "absl/strings/str_format.h"
 
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -60,6 +62,10 @@
 #include "src/core/lib/iomgr/tcp_server_utils_posix.h"
 #include "src/core/lib/iomgr/unix_sockets_posix.h"
 
+/* Maximum number of connections a listener accepts per read notification
+   before yielding to other closures queued on the ExecCtx. */
+#define MAX_ACCEPTS_PER_READ 64
+
 static grpc_error* tcp_server_create(grpc_closure* shutdown_complete,
                                      const grpc_channel_args* args,
                                      grpc_tcp_server** server) {
@@ -77,6 +83,14 @@ static grpc_error* tcp_server_create(grpc_closure* shutdown_complete,
         return GRPC_ERROR_CREATE_FROM_STATIC_STRING(GRPC_ARG_ALLOW_REUSEPORT
                                                     " must be an integer");
       }
+    } else if (0 == strcmp(GRPC_ARG_STEER_INCOMING_CPU, args->args[i].key)) {
+      if (args->args[i].type == GRPC_ARG_INTEGER) {
+        s->so_incoming_cpu = (args->args[i].value.integer != 0);
+      } else {
+        gpr_free(s);
+        return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            GRPC_ARG_STEER_INCOMING_CPU " must be an integer");
+      }
     } else if (0 == strcmp(GRPC_ARG_EXPAND_WILDCARD_ADDRS, args->args[i].key)) {
       if (args->args[i].type == GRPC_ARG_INTEGER) {
         s->expand_wildcard_addrs = (args->args[i].value.integer != 0);
@@ -191,12 +205,23 @@ static void tcp_server_destroy(grpc_tcp_server* s) {
 static void on_read(void* arg, grpc_error* err) {
   grpc_tcp_listener* sp = static_cast<grpc_tcp_listener*>(arg);
   grpc_pollset* read_notifier_pollset;
+  int accepts = 0;
   if (err != GRPC_ERROR_NONE) {
     goto error;
   }
 
   /* loop until accept4 returns EAGAIN, and then re-arm notification */
   for (;;) {
+    if (accepts == MAX_ACCEPTS_PER_READ) {
+      /* The backlog is deeper than our budget: let the connections accepted so
+         far make progress, then come back for the rest. Notifications are
+         edge triggered, so the listener is rescheduled directly instead of
+         being re-armed. */
+      GRPC_STATS_INC_TCP_SERVER_ACCEPT_YIELDS();
+      grpc_core::ExecCtx::Run(DEBUG_LOCATION, &sp->read_closure,
+                              GRPC_ERROR_NONE);
+      return;
+    }
     grpc_resolved_address addr;
     memset(&addr, 0, sizeof(addr));
     addr.len = static_cast<socklen_t>(sizeof(struct sockaddr_storage));
@@ -237,6 +262,8 @@ static void on_read(void* arg, grpc_error* err) {
     }
 
     grpc_set_socket_no_sigpipe_if_possible(fd);
+    GRPC_STATS_INC_TCP_SERVER_ACCEPTS();
+    ++accepts;
 
     std::string addr_str = grpc_sockaddr_to_uri(&addr);
     if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
@@ -507,6 +534,12 @@ static void tcp_server_start(grpc_tcp_server* s,
       GPR_ASSERT(GRPC_LOG_IF_ERROR(
           "clone_port", clone_port(sp, (unsigned)(pollsets->size() - 1))));
       for (i = 0; i < pollsets->size(); i++) {
+        if (s->so_incoming_cpu) {
+          GRPC_LOG_IF_ERROR(
+              "steer_incoming_cpu",
+              grpc_set_socket_incoming_cpu(
+                  sp->fd, static_cast<int>(i % gpr_cpu_num_cores())));
+        }
         grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                           grpc_schedule_on_exec_ctx);
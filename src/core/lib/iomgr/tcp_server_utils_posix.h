@@ -68,6 +68,8 @@ struct grpc_tcp_server {
   bool shutdown_listeners;
   /* use SO_REUSEPORT */
   bool so_reuseport;
+  /* steer cloned SO_REUSEPORT listeners to CPUs with SO_INCOMING_CPU */
+  bool so_incoming_cpu;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs;
 
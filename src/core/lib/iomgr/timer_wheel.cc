@@ -0,0 +1,430 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/timer_wheel.h"
+
+#include <inttypes.h>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_timer_wheel, false,
+    "If true, use the hierarchical timing wheel timer implementation instead "
+    "of the heap based one.");
+
+/* Shared with timer_generic.cc so that the same tracers cover both
+   implementations. */
+extern grpc_core::TraceFlag grpc_timer_trace;
+extern grpc_core::TraceFlag grpc_timer_check_trace;
+
+#define WHEEL_LEVELS 4
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+/* Index of the slot holding timers beyond the reach of the top level. */
+#define OVERFLOW_SLOT (WHEEL_LEVELS * WHEEL_SLOTS)
+/* Log2 of the number of ticks covered by one slot of the top level. */
+#define TOP_LEVEL_SHIFT ((WHEEL_LEVELS - 1) * WHEEL_BITS)
+
+/* A hierarchical timing wheel with one tick per millisecond. Level L has
+ * WHEEL_SLOTS slots, each covering 2^(WHEEL_BITS * L) ticks. A timer lives in
+ * the lowest level whose window (measured from 'base') reaches its deadline,
+ * and is cascaded into a lower level when 'base' enters its slot. Timers too
+ * far out for the top level wait in the overflow slot, which is re-sorted
+ * whenever 'base' crosses a top level slot boundary.
+ *
+ * Each slot is a nullptr terminated doubly linked list; a timer's slot index
+ * is kept in its 'heap_index' field. The 'occupied' bitmaps let the next
+ * event be found without scanning empty slots.
+ */
+struct timer_wheel {
+  gpr_mu mu;
+  /* The next tick still to be processed. */
+  grpc_millis base;
+  /* The next event of this wheel as last published to g_min_timer. Only
+     lowered by timer_init, recomputed by timer_check. */
+  grpc_millis min_deadline;
+  size_t count;
+  uint64_t occupied[WHEEL_LEVELS];
+  grpc_timer* slots[OVERFLOW_SLOT + 1];
+};
+
+static size_t g_num_wheels;
+
+/* Array of timing wheels. Whenever a timer (grpc_timer *) is added, its
+ * address is hashed to select the wheel to add the timer to */
+static timer_wheel* g_wheels;
+
+static bool g_initialized = false;
+/* Allow only one run_some_expired_timers at once */
+static gpr_spinlock g_checker_mu;
+/* Protects g_min_timer updates and the wheels' min_deadline */
+static gpr_mu g_mu;
+/* The deadline of the next timer due across all wheels */
+static grpc_core::Atomic<grpc_millis> g_min_timer;
+
+static int lowest_set_bit(uint64_t x) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(x);
+#else
+  int n = 0;
+  while ((x & 1) == 0) {
+    x >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+static void slot_add(timer_wheel* w, uint32_t slot, grpc_timer* timer) {
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = w->slots[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  w->slots[slot] = timer;
+  if (slot != OVERFLOW_SLOT) {
+    w->occupied[slot / WHEEL_SLOTS] |= uint64_t(1) << (slot % WHEEL_SLOTS);
+  }
+}
+
+static void slot_remove(timer_wheel* w, grpc_timer* timer) {
+  uint32_t slot = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    w->slots[slot] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (w->slots[slot] == nullptr && slot != OVERFLOW_SLOT) {
+    w->occupied[slot / WHEEL_SLOTS] &= ~(uint64_t(1) << (slot % WHEEL_SLOTS));
+  }
+}
+
+/* Detaches and returns the whole list held by 'slot'. */
+static grpc_timer* slot_take(timer_wheel* w, uint32_t slot) {
+  grpc_timer* head = w->slots[slot];
+  w->slots[slot] = nullptr;
+  if (slot != OVERFLOW_SLOT) {
+    w->occupied[slot / WHEEL_SLOTS] &= ~(uint64_t(1) << (slot % WHEEL_SLOTS));
+  }
+  return head;
+}
+
+/* Returns the slot a timer due at 'deadline' belongs in, given the wheel's
+   current base. Deadlines already behind base are treated as due at base. */
+static uint32_t slot_for(const timer_wheel* w, grpc_millis deadline) {
+  grpc_millis d = GPR_MAX(deadline, w->base);
+  for (uint32_t level = 0; level < WHEEL_LEVELS; level++) {
+    uint32_t shift = level * WHEEL_BITS;
+    if ((d >> shift) - (w->base >> shift) < WHEEL_SLOTS) {
+      return level * WHEEL_SLOTS + static_cast<uint32_t>((d >> shift) & WHEEL_MASK);
+    }
+  }
+  return OVERFLOW_SLOT;
+}
+
+/* Returns the earliest tick at which the wheel has work to do: either a timer
+   expires or a slot has to be cascaded. This is never later than the earliest
+   pending deadline. REQUIRES: w->mu locked */
+static grpc_millis next_event(const timer_wheel* w) {
+  if (w->count == 0) return GRPC_MILLIS_INF_FUTURE;
+  grpc_millis next = GRPC_MILLIS_INF_FUTURE;
+  for (uint32_t level = 0; level < WHEEL_LEVELS; level++) {
+    uint64_t occupied = w->occupied[level];
+    if (occupied == 0) continue;
+    uint32_t shift = level * WHEEL_BITS;
+    grpc_millis group = w->base >> shift;
+    uint32_t current = static_cast<uint32_t>(group & WHEEL_MASK);
+    /* rotate so that bit k stands for the k'th slot from the current one */
+    uint64_t rotated =
+        current == 0 ? occupied
+                     : (occupied >> current) | (occupied << (WHEEL_SLOTS - current));
+    int k = lowest_set_bit(rotated);
+    grpc_millis tick;
+    if (level == 0) {
+      tick = w->base + k;
+    } else if (k == 0) {
+      tick = w->base;
+    } else {
+      tick = (group + k) << shift;
+    }
+    next = GPR_MIN(next, tick);
+  }
+  if (w->slots[OVERFLOW_SLOT] != nullptr) {
+    grpc_millis top_mask = (grpc_millis(1) << TOP_LEVEL_SHIFT) - 1;
+    grpc_millis tick =
+        (w->base & top_mask) == 0
+            ? w->base
+            : ((w->base >> TOP_LEVEL_SHIFT) + 1) << TOP_LEVEL_SHIFT;
+    next = GPR_MIN(next, tick);
+  }
+  return next;
+}
+
+/* Re-sorts the timers of 'slot' relative to the current base.
+   REQUIRES: w->mu locked */
+static void cascade(timer_wheel* w, uint32_t slot) {
+  grpc_timer* timer = slot_take(w, slot);
+  while (timer != nullptr) {
+    grpc_timer* next = timer->next;
+    slot_add(w, slot_for(w, timer->deadline), timer);
+    timer = next;
+  }
+}
+
+/* Schedules the closures of every timer in 'head' with 'error'. Returns the
+   number of timers run. REQUIRES: w->mu locked */
+static size_t fire_list(timer_wheel* w, grpc_timer* head, grpc_error* error) {
+  size_t n = 0;
+  while (head != nullptr) {
+    grpc_timer* timer = head;
+    head = head->next;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+      gpr_log(GPR_INFO, "  .. fire timer %p deadline=%" PRId64, timer,
+              timer->deadline);
+    }
+    timer->pending = false;
+    w->count--;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                            GRPC_ERROR_REF(error));
+    n++;
+  }
+  return n;
+}
+
+/* Processes every tick up to and including 'now', running the timers that
+   expire on the way. Returns the number of timers run.
+   REQUIRES: w->mu locked */
+static size_t advance(timer_wheel* w, grpc_millis now, grpc_error* error) {
+  const grpc_millis top_mask = (grpc_millis(1) << TOP_LEVEL_SHIFT) - 1;
+  size_t n = 0;
+  for (;;) {
+    grpc_millis tick = next_event(w);
+    if (tick > now) break;
+    w->base = tick;
+    if ((tick & top_mask) == 0 && w->slots[OVERFLOW_SLOT] != nullptr) {
+      cascade(w, OVERFLOW_SLOT);
+    }
+    for (uint32_t level = WHEEL_LEVELS - 1; level > 0; level--) {
+      uint32_t slot = level * WHEEL_SLOTS +
+                      static_cast<uint32_t>((tick >> (level * WHEEL_BITS)) &
+                                            WHEEL_MASK);
+      if (w->slots[slot] != nullptr) cascade(w, slot);
+    }
+    n += fire_list(w, slot_take(w, static_cast<uint32_t>(tick & WHEEL_MASK)),
+                   error);
+    w->base = tick + 1;
+  }
+  if (w->base <= now) w->base = now + 1;
+  return n;
+}
+
+/* Runs every timer of the wheel regardless of its deadline.
+   REQUIRES: w->mu locked */
+static size_t drain(timer_wheel* w, grpc_error* error) {
+  size_t n = 0;
+  for (uint32_t slot = 0; slot <= OVERFLOW_SLOT; slot++) {
+    if (w->slots[slot] != nullptr) n += fire_list(w, slot_take(w, slot), error);
+  }
+  return n;
+}
+
+static grpc_timer_check_result run_some_expired_timers(grpc_millis now,
+                                                       grpc_millis* next,
+                                                       grpc_error* error) {
+  grpc_timer_check_result result = GRPC_TIMERS_NOT_CHECKED;
+  if (gpr_spinlock_trylock(&g_checker_mu)) {
+    gpr_mu_lock(&g_mu);
+    size_t fired = 0;
+    grpc_millis min_timer = GRPC_MILLIS_INF_FUTURE;
+    for (size_t i = 0; i < g_num_wheels; i++) {
+      timer_wheel* w = &g_wheels[i];
+      gpr_mu_lock(&w->mu);
+      fired += now == GRPC_MILLIS_INF_FUTURE ? drain(w, error)
+                                             : advance(w, now, error);
+      w->min_deadline = next_event(w);
+      min_timer = GPR_MIN(min_timer, w->min_deadline);
+      gpr_mu_unlock(&w->mu);
+    }
+    g_min_timer.Store(min_timer, grpc_core::MemoryOrder::RELAXED);
+    if (next != nullptr) *next = GPR_MIN(*next, min_timer);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+      gpr_log(GPR_INFO,
+              "  .. fired %" PRIuPTR " timers, min_timer=%" PRId64
+              ", now=%" PRId64,
+              fired, min_timer, now);
+    }
+    gpr_mu_unlock(&g_mu);
+    gpr_spinlock_unlock(&g_checker_mu);
+    result = fired > 0 ? GRPC_TIMERS_FIRED : GRPC_TIMERS_CHECKED_AND_EMPTY;
+  }
+  GRPC_ERROR_UNREF(error);
+  return result;
+}
+
+static void timer_list_init() {
+  g_num_wheels = GPR_CLAMP(gpr_cpu_num_cores(), 1, 32);
+  g_wheels =
+      static_cast<timer_wheel*>(gpr_zalloc(g_num_wheels * sizeof(*g_wheels)));
+  g_checker_mu = GPR_SPINLOCK_INITIALIZER;
+  gpr_mu_init(&g_mu);
+  g_min_timer.Store(GRPC_MILLIS_INF_FUTURE, grpc_core::MemoryOrder::RELAXED);
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  for (size_t i = 0; i < g_num_wheels; i++) {
+    timer_wheel* w = &g_wheels[i];
+    gpr_mu_init(&w->mu);
+    w->base = now;
+    w->min_deadline = GRPC_MILLIS_INF_FUTURE;
+  }
+  g_initialized = true;
+}
+
+static void timer_list_shutdown() {
+  run_some_expired_timers(
+      GRPC_MILLIS_INF_FUTURE, nullptr,
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Timer list shutdown"));
+  for (size_t i = 0; i < g_num_wheels; i++) {
+    gpr_mu_destroy(&g_wheels[i].mu);
+  }
+  gpr_mu_destroy(&g_mu);
+  gpr_free(g_wheels);
+  g_initialized = false;
+}
+
+static void timer_init(grpc_timer* timer, grpc_millis deadline,
+                       grpc_closure* closure) {
+  timer->closure = closure;
+  timer->deadline = deadline;
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO, "TIMER %p: SET %" PRId64 " now %" PRId64 " call %p[%p]",
+            timer, deadline, grpc_core::ExecCtx::Get()->Now(), closure,
+            closure->cb);
+  }
+
+  if (!g_initialized) {
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, timer->closure,
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "Attempt to create timer before initialization"));
+    return;
+  }
+
+  timer_wheel* w = &g_wheels[GPR_HASH_POINTER(timer, g_num_wheels)];
+  gpr_mu_lock(&w->mu);
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  if (deadline <= now) {
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure, GRPC_ERROR_NONE);
+    gpr_mu_unlock(&w->mu);
+    /* early out */
+    return;
+  }
+  timer->pending = true;
+  slot_add(w, slot_for(w, deadline), timer);
+  w->count++;
+  bool is_first_timer = deadline < w->min_deadline;
+  if (is_first_timer) w->min_deadline = deadline;
+  gpr_mu_unlock(&w->mu);
+
+  /* The wheel's min_deadline is lowered under w->mu, and timer_check
+     recomputes it under both w->mu and g_mu, so taking g_mu here orders this
+     update after any concurrent check that missed the new timer. */
+  if (is_first_timer) {
+    gpr_mu_lock(&g_mu);
+    if (deadline < g_min_timer.Load(grpc_core::MemoryOrder::RELAXED)) {
+      g_min_timer.Store(deadline, grpc_core::MemoryOrder::RELAXED);
+      grpc_kick_poller();
+    }
+    gpr_mu_unlock(&g_mu);
+  }
+}
+
+static void timer_cancel(grpc_timer* timer) {
+  if (!g_initialized) {
+    /* must have already been cancelled, also the wheel mutex is invalid */
+    return;
+  }
+
+  timer_wheel* w = &g_wheels[GPR_HASH_POINTER(timer, g_num_wheels)];
+  gpr_mu_lock(&w->mu);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO, "TIMER %p: CANCEL pending=%s", timer,
+            timer->pending ? "true" : "false");
+  }
+
+  if (timer->pending) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                            GRPC_ERROR_CANCELLED);
+    timer->pending = false;
+    slot_remove(w, timer);
+    w->count--;
+  }
+  gpr_mu_unlock(&w->mu);
+}
+
+static grpc_timer_check_result timer_check(grpc_millis* next) {
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  grpc_millis min_timer = g_min_timer.Load(grpc_core::MemoryOrder::RELAXED);
+
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = GPR_MIN(*next, min_timer);
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+      gpr_log(GPR_INFO, "TIMER CHECK SKIP: now=%" PRId64 " min_timer=%" PRId64,
+              now, min_timer);
+    }
+    return GRPC_TIMERS_CHECKED_AND_EMPTY;
+  }
+
+  grpc_error* shutdown_error =
+      now != GRPC_MILLIS_INF_FUTURE
+          ? GRPC_ERROR_NONE
+          : GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shutting down timer system");
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+    gpr_log(GPR_INFO, "TIMER CHECK BEGIN: now=%" PRId64 " min_timer=%" PRId64,
+            now, min_timer);
+  }
+  return run_some_expired_timers(now, next, shutdown_error);
+}
+
+/* Kicks only wake the poller so that it re-reads g_min_timer, which needs no
+   cached state to be reset. */
+static void timer_consume_kick(void) {}
+
+grpc_timer_vtable grpc_wheel_timer_vtable = {
+    timer_init,      timer_cancel,        timer_check,
+    timer_list_init, timer_list_shutdown, timer_consume_kick};
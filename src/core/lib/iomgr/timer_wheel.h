@@ -0,0 +1,37 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H
+#define GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/iomgr/timer.h"
+
+/* When set, the posix iomgr uses grpc_wheel_timer_vtable instead of the
+   default heap based timers. */
+GPR_GLOBAL_CONFIG_DECLARE_BOOL(grpc_timer_wheel);
+
+/* Hierarchical timing wheel implementation of grpc_timer. Adding and
+   cancelling a timer is O(1) regardless of how many timers are pending, which
+   suits servers that keep a deadline timer per active call. Deadlines are
+   tracked with millisecond resolution. */
+extern grpc_timer_vtable grpc_wheel_timer_vtable;
+
+#endif /* GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H */
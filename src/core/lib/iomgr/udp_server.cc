@@ -69,6 +69,10 @@
 #include "src/core/lib/iomgr/socket_utils_posix.h"
 #include "src/core/lib/iomgr/unix_sockets_posix.h"
 
+/* Number of datagrams a read job on the executor hands to the handler before
+ * yielding the listener mutex (which do_write() also needs) and requeueing. */
+#define MAX_READS_PER_EXECUTOR_JOB 64
+
 /* A listener which implements basic features of Listening on a port for
  * I/O events*/
 class GrpcUdpListener {
@@ -443,8 +447,17 @@ void GrpcUdpListener::do_read(void* arg, grpc_error* error) {
    * shutdown while we are reading. However, it blocks do_write(). Switch to
    * read lock if available. */
   gpr_mu_lock(sp->mutex());
-  /* Tell the registered callback that data is available to read. */
-  if (!sp->already_shutdown_ && sp->udp_handler_->Read()) {
+  /* Tell the registered callback that data is available to read, as long as
+   * it reports more, so that a burst of datagrams costs one executor job per
+   * batch rather than one per datagram. */
+  bool more = false;
+  for (int i = 0; i < MAX_READS_PER_EXECUTOR_JOB; i++) {
+    more = !sp->already_shutdown_ && sp->udp_handler_->Read();
+    if (!more) {
+      break;
+    }
+  }
+  if (more) {
     /* There maybe more packets to read. Schedule read_more_cb_ closure to run
      * after finishing this event loop. */
     grpc_core::Executor::Run(&sp->do_read_closure_, GRPC_ERROR_NONE,
@@ -170,6 +170,33 @@ void grpc_slice_buffer_add(grpc_slice_buffer* sb, grpc_slice s) {
   grpc_slice_buffer_add_indexed(sb, s);
 }
 
+void grpc_slice_buffer_append_copied(grpc_slice_buffer* sb, const void* data,
+                                     size_t n) {
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  if (sb->count != 0) {
+    grpc_slice* back = &sb->slices[sb->count - 1];
+    if (!back->refcount &&
+        back->data.inlined.length < GRPC_SLICE_INLINED_SIZE) {
+      const size_t cp = GPR_MIN(
+          n, static_cast<size_t>(GRPC_SLICE_INLINED_SIZE -
+                                 back->data.inlined.length));
+      memcpy(back->data.inlined.bytes + back->data.inlined.length, p, cp);
+      back->data.inlined.length =
+          static_cast<uint8_t>(back->data.inlined.length + cp);
+      sb->length += cp;
+      p += cp;
+      n -= cp;
+    }
+  }
+  if (n == 0) {
+    return;
+  }
+  /* inlined if it fits, otherwise one allocation for all of it */
+  grpc_slice s = GRPC_SLICE_MALLOC(n);
+  memcpy(GRPC_SLICE_START_PTR(s), p, n);
+  grpc_slice_buffer_add_indexed(sb, s);
+}
+
 void grpc_slice_buffer_addn(grpc_slice_buffer* sb, grpc_slice* s, size_t n) {
   size_t i;
   for (i = 0; i < n; i++) {
@@ -34,7 +34,9 @@
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/static_metadata.h"
 
-#define LOG2_SHARD_COUNT 5
+/* every intern and every final unref of an interned slice takes its shard
+   lock, so keep enough shards that busy servers rarely collide */
+#define LOG2_SHARD_COUNT 7
 #define SHARD_COUNT (1 << LOG2_SHARD_COUNT)
 #define INITIAL_SHARD_CAPACITY 8
 
@@ -43,12 +45,14 @@
 
 using grpc_core::InternedSliceRefcount;
 
+/* shards are cacheline aligned so that threads working on neighbouring
+   shards don't contend on the same line */
 typedef struct slice_shard {
   gpr_mu mu;
   InternedSliceRefcount** strs;
   size_t count;
   size_t capacity;
-} slice_shard;
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE) slice_shard;
 
 static slice_shard g_shards[SHARD_COUNT];
 
@@ -294,6 +294,13 @@ void grpc_slice_buffer_remove_first(grpc_slice_buffer* sb);
 void grpc_slice_buffer_sub_first(grpc_slice_buffer* sb, size_t begin,
                                  size_t end);
 
+// Appends a copy of n bytes at data to the slice buffer. The bytes first fill
+// whatever room is left in an inlined tail slice, and the rest go into a
+// single new slice, so a run of small appends neither allocates per call nor
+// grows the slice array per call.
+void grpc_slice_buffer_append_copied(grpc_slice_buffer* sb, const void* data,
+                                     size_t n);
+
 /* Check if a slice is interned */
 bool grpc_slice_is_interned(const grpc_slice& slice);
 inline bool grpc_slice_is_interned(const grpc_slice& slice) {
@@ -363,10 +363,12 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
                MAX_SEND_EXTRA_METADATA_COUNT);
     for (size_t i = 0; i < args->add_initial_metadata_count; i++) {
       call->send_extra_metadata[i].md = args->add_initial_metadata[i];
+      /* send_extra_metadata holds the :path element until the call stack is
+         initialized below, so the value can be borrowed without a ref: call
+         elements that keep the path take their own. */
       if (grpc_slice_eq_static_interned(
               GRPC_MDKEY(args->add_initial_metadata[i]), GRPC_MDSTR_PATH)) {
-        path = grpc_slice_ref_internal(
-            GRPC_MDVALUE(args->add_initial_metadata[i]));
+        path = GRPC_MDVALUE(args->add_initial_metadata[i]);
       }
     }
     call->send_extra_metadata_count =
@@ -484,8 +486,6 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
     }
   }
 
-  grpc_slice_unref_internal(path);
-
   return error;
 }
 
@@ -40,6 +40,7 @@
 #include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/iomgr/executor.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
 #include "src/core/lib/iomgr/pollset.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/profiling/timers.h"
@@ -445,6 +446,59 @@ void grpc_cq_global_init() {
   gpr_tls_init(&g_cached_cq);
 }
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_callback_cq_threads, 0,
+    "If positive, callback completion queue functors that cannot run inline "
+    "are run on a dedicated pool of this many threads instead of the shared "
+    "executor.");
+
+namespace {
+
+grpc_core::ThreadPool* g_callback_pool = nullptr;
+
+// Wraps a functor queued on g_callback_pool so that it runs with the same
+// exec_ctx setup as a closure run by the executor.
+struct CallbackPoolEntry : public grpc_experimental_completion_queue_functor {
+  explicit CallbackPoolEntry(grpc_experimental_completion_queue_functor* f,
+                             int ok)
+      : functor(f) {
+    functor_run = Run;
+    inlineable = false;
+    internal_success = ok;
+  }
+
+  static void Run(grpc_experimental_completion_queue_functor* cb, int ok) {
+    auto* entry = static_cast<CallbackPoolEntry*>(cb);
+    grpc_experimental_completion_queue_functor* functor = entry->functor;
+    delete entry;
+    grpc_core::ExecCtx exec_ctx(GRPC_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+        GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+    functor->functor_run(functor, ok);
+  }
+
+  grpc_experimental_completion_queue_functor* functor;
+};
+
+}  // namespace
+
+void grpc_cq_callback_pool_init() {
+  int32_t num_threads = GPR_GLOBAL_CONFIG_GET(grpc_callback_cq_threads);
+  if (num_threads > 0) {
+    // Functors run application reactions, so don't use the small default
+    // stack of ThreadPool workers.
+    grpc_core::Thread::Options options;
+    options.set_stack_size(1024 * 1024);
+    g_callback_pool =
+        new grpc_core::ThreadPool(num_threads, "callback-cq", options);
+  }
+}
+
+void grpc_cq_callback_pool_shutdown() {
+  delete g_callback_pool;
+  g_callback_pool = nullptr;
+}
+
 void grpc_completion_queue_thread_local_cache_init(grpc_completion_queue* cq) {
   if ((grpc_completion_queue*)gpr_tls_get(&g_cached_cq) == nullptr) {
     gpr_tls_set(&g_cached_event, (intptr_t)0);
@@ -888,6 +942,12 @@ static void cq_end_op_for_callback(
 
   // Schedule the callback on a closure if not internal or triggered
   // from a background poller thread.
+  if (g_callback_pool != nullptr) {
+    g_callback_pool->Add(
+        new CallbackPoolEntry(functor, error == GRPC_ERROR_NONE));
+    GRPC_ERROR_UNREF(error);
+    return;
+  }
   grpc_core::Executor::Run(
       GRPC_CLOSURE_CREATE(functor_callback, functor, nullptr), error);
 }
@@ -26,6 +26,7 @@
 #include <grpc/grpc.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/pollset.h"
 
@@ -69,6 +70,16 @@ void grpc_cq_internal_unref(grpc_completion_queue* cc);
 /* Initializes global variables used by completion queues */
 void grpc_cq_global_init();
 
+/* Number of threads that run callback completion queue functors; 0 (the
+   default) runs them on the executor. */
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_callback_cq_threads);
+
+/* Starts and stops the thread pool that runs callback completion queue
+   functors when GRPC_CALLBACK_CQ_THREADS is set. Called from grpc_init() and
+   grpc_shutdown(); shutdown waits for the queued functors to run. */
+void grpc_cq_callback_pool_init();
+void grpc_cq_callback_pool_shutdown();
+
 /* Flag that an operation is beginning: the completion channel will not finish
    shutdown until a corrensponding grpc_cq_end_* call is made.
    \a tag is currently used only in debug builds. Return true on success, and
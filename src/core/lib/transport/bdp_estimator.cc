@@ -37,6 +37,7 @@ BdpEstimator::BdpEstimator(const char* name)
       inter_ping_delay_(100.0),  // start at 100ms
       stable_estimate_count_(0),
       bw_est_(0),
+      rtt_est_(0),
       name_(name) {}
 
 grpc_millis BdpEstimator::CompletePing() {
@@ -54,6 +55,10 @@ grpc_millis BdpEstimator::CompletePing() {
             bw_est_ / 125000.0);
   }
   GPR_ASSERT(ping_state_ == PingState::STARTED);
+  if (dt > 0) {
+    // smooth rtt samples the way tcp does (rfc 6298, alpha = 1/8)
+    rtt_est_ = rtt_est_ == 0 ? dt : rtt_est_ + (dt - rtt_est_) / 8;
+  }
   if (accumulator_ > 2 * estimate_ / 3 && bw > bw_est_) {
     estimate_ = GPR_MAX(accumulator_, estimate_ * 2);
     bw_est_ = bw;
@@ -356,6 +356,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/iomgr/timer_generic.cc',
     'src/core/lib/iomgr/timer_heap.cc',
     'src/core/lib/iomgr/timer_manager.cc',
+    'src/core/lib/iomgr/timer_wheel.cc',
     'src/core/lib/iomgr/timer_uv.cc',
     'src/core/lib/iomgr/udp_server.cc',
     'src/core/lib/iomgr/unix_sockets_posix.cc',
@@ -533,6 +533,52 @@ TEST(ChannelzServerTest, BasicServerAPIFunctionality) {
   ValidateServer(channelz_server, {3, 3, 3});
 }
 
+TEST(ChannelzSocketTest, WriteSizingRenderedAsOptions) {
+  grpc_core::ExecCtx exec_ctx;
+  RefCountedPtr<SocketNode> socket =
+      MakeRefCounted<SocketNode>("ipv4:127.0.0.1:10", "ipv4:127.0.0.1:20",
+                                 "test socket");
+  // nothing recorded: no options rendered
+  Json json = socket->RenderJson();
+  EXPECT_EQ(json.object_value().at("data").object_value().count("option"),
+            0u);
+  socket->RecordWriteSizing(65536, 262144);
+  json = socket->RenderJson();
+  const Json::Object& data = json.object_value().at("data").object_value();
+  auto it = data.find("option");
+  ASSERT_NE(it, data.end());
+  const Json::Array& options = it->second.array_value();
+  ASSERT_EQ(options.size(), 2u);
+  EXPECT_EQ(options[0].object_value().at("name").string_value(),
+            "grpc.http2.target_frame_size");
+  EXPECT_EQ(options[0].object_value().at("value").string_value(), "65536");
+  EXPECT_EQ(options[1].object_value().at("name").string_value(),
+            "grpc.http2.target_write_size");
+  EXPECT_EQ(options[1].object_value().at("value").string_value(), "262144");
+}
+
+TEST(ChannelzSocketTest, NetworkEstimatesRenderedAsOptions) {
+  grpc_core::ExecCtx exec_ctx;
+  RefCountedPtr<SocketNode> socket =
+      MakeRefCounted<SocketNode>("ipv4:127.0.0.1:10", "ipv4:127.0.0.1:20",
+                                 "test socket");
+  socket->RecordNetworkEstimates(1500, 131072);
+  EXPECT_EQ(socket->smoothed_rtt_micros(), 1500);
+  EXPECT_EQ(socket->bdp_bytes(), 131072);
+  Json json = socket->RenderJson();
+  const Json::Object& data = json.object_value().at("data").object_value();
+  auto it = data.find("option");
+  ASSERT_NE(it, data.end());
+  const Json::Array& options = it->second.array_value();
+  ASSERT_EQ(options.size(), 2u);
+  EXPECT_EQ(options[0].object_value().at("name").string_value(),
+            "grpc.http2.smoothed_rtt_us");
+  EXPECT_EQ(options[0].object_value().at("value").string_value(), "1500");
+  EXPECT_EQ(options[1].object_value().at("name").string_value(),
+            "grpc.http2.bdp_estimate");
+  EXPECT_EQ(options[1].object_value().at("value").string_value(), "131072");
+}
+
 TEST_F(ChannelzRegistryBasedTest, BasicGetServersTest) {
   grpc_core::ExecCtx exec_ctx;
   ServerFixture server;
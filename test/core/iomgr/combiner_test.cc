@@ -136,12 +136,43 @@ static void test_execute_finally(void) {
   GRPC_COMBINER_UNREF(lock, "test_execute_finally");
 }
 
+static void increment(void* arg, grpc_error* /*error*/) {
+  ++*static_cast<size_t*>(arg);
+}
+
+static void check_all_work_done(void* arg, grpc_error* /*error*/) {
+  GPR_ASSERT(*static_cast<size_t*>(arg) == 2);
+  ++*static_cast<size_t*>(arg);
+}
+
+static void test_run_when_idle(void) {
+  gpr_log(GPR_DEBUG, "test_run_when_idle");
+
+  grpc_core::Combiner* lock = grpc_combiner_create();
+  grpc_core::ExecCtx exec_ctx;
+  size_t ctr = 0;
+  grpc_core::ExecCtx::RunWhenIdle(
+      DEBUG_LOCATION,
+      GRPC_CLOSURE_CREATE(check_all_work_done, &ctr, nullptr),
+      GRPC_ERROR_NONE);
+  lock->Run(GRPC_CLOSURE_CREATE(increment, &ctr, nullptr), GRPC_ERROR_NONE);
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION,
+                          GRPC_CLOSURE_CREATE(increment, &ctr, nullptr),
+                          GRPC_ERROR_NONE);
+  GPR_ASSERT(grpc_core::ExecCtx::Get()->HasWork());
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(ctr == 3);
+  GPR_ASSERT(!grpc_core::ExecCtx::Get()->HasWork());
+  GRPC_COMBINER_UNREF(lock, "test_run_when_idle");
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_no_op();
   test_execute_one();
   test_execute_finally();
+  test_run_when_idle();
   test_execute_many();
   grpc_shutdown();
 
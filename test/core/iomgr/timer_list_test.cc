@@ -23,6 +23,7 @@
 
 #include "src/core/lib/iomgr/iomgr_internal.h"
 #include "src/core/lib/iomgr/timer.h"
+#include "src/core/lib/iomgr/timer_wheel.h"
 
 #include <string.h>
 
@@ -153,6 +154,45 @@ void destruction_test(void) {
   GPR_ASSERT(1 == cb_called[2][0]);
 }
 
+/* Timers that start out in the upper levels of the timing wheel must still
+   fire on their deadline, not before and not after. */
+static void far_deadlines_test(void) {
+  const int kNumTimers = 5;
+  static const grpc_millis kDelays[kNumTimers] = {5, 100, 5000, 300000,
+                                                  20000000};
+  grpc_timer timers[kNumTimers];
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "far_deadlines_test");
+
+  grpc_timer_list_init();
+  memset(cb_called, 0, sizeof(cb_called));
+
+  grpc_millis start = grpc_core::ExecCtx::Get()->Now();
+  for (int i = 0; i < kNumTimers; i++) {
+    grpc_timer_init(
+        &timers[i], start + kDelays[i],
+        GRPC_CLOSURE_CREATE(cb, (void*)(intptr_t)i, grpc_schedule_on_exec_ctx));
+  }
+
+  for (int i = 0; i < kNumTimers; i++) {
+    grpc_core::ExecCtx::Get()->TestOnlySetNow(start + kDelays[i] - 1);
+    grpc_timer_check(nullptr);
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(cb_called[i][1] == 0);
+
+    grpc_core::ExecCtx::Get()->TestOnlySetNow(start + kDelays[i]);
+    GPR_ASSERT(grpc_timer_check(nullptr) == GRPC_TIMERS_FIRED);
+    grpc_core::ExecCtx::Get()->Flush();
+    for (int j = 0; j < kNumTimers; j++) {
+      GPR_ASSERT(cb_called[j][1] == (j <= i));
+      GPR_ASSERT(cb_called[j][0] == 0);
+    }
+  }
+
+  grpc_timer_list_shutdown();
+}
+
 /* Cleans up a list with pending timers that simulate long-running-services.
    This test does the following:
     1) Simulates grpc server start time to 25 days in the past (completed in
@@ -229,6 +269,23 @@ int main(int argc, char** argv) {
     gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
     add_test();
     destruction_test();
+    far_deadlines_test();
+    grpc_iomgr_platform_shutdown();
+  }
+  grpc_core::ExecCtx::GlobalShutdown();
+
+  /* Same tests against the timing wheel implementation */
+  {
+    grpc::testing::TestEnvironment env(argc, argv);
+    grpc_core::ExecCtx::GlobalInit();
+    grpc_core::ExecCtx exec_ctx;
+    grpc_determine_iomgr_platform();
+    grpc_iomgr_platform_init();
+    grpc_set_timer_impl(&grpc_wheel_timer_vtable);
+    gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
+    add_test();
+    destruction_test();
+    far_deadlines_test();
     grpc_iomgr_platform_shutdown();
   }
   grpc_core::ExecCtx::GlobalShutdown();
@@ -255,6 +312,26 @@ int main(int argc, char** argv) {
   }
   grpc_core::ExecCtx::GlobalShutdown();
 
+  /* Long running service tests against the timing wheel implementation */
+  {
+    grpc::testing::TestEnvironment env(argc, argv);
+    gpr_timespec new_start =
+        gpr_time_sub(gpr_now(gpr_clock_type::GPR_CLOCK_MONOTONIC),
+                     gpr_time_from_hours(kHoursIn25Days,
+                                         gpr_clock_type::GPR_CLOCK_MONOTONIC));
+    grpc_core::ExecCtx::TestOnlyGlobalInit(new_start);
+    grpc_core::ExecCtx exec_ctx;
+    grpc_determine_iomgr_platform();
+    grpc_iomgr_platform_init();
+    grpc_set_timer_impl(&grpc_wheel_timer_vtable);
+    gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
+    long_running_service_cleanup_test();
+    add_test();
+    destruction_test();
+    grpc_iomgr_platform_shutdown();
+  }
+  grpc_core::ExecCtx::GlobalShutdown();
+
   return 0;
 }
 
@@ -16,6 +16,8 @@
  *
  */
 
+#include <string.h>
+
 #include <grpc/grpc.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/log.h>
@@ -147,6 +149,38 @@ void test_slice_buffer_first() {
   GPR_ASSERT(buf.length == 0);
 }
 
+void test_slice_buffer_append_copied() {
+  grpc_slice_buffer buf;
+  grpc_slice_buffer_init(&buf);
+  const char* data = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+  /* small appends are packed into one inlined slice */
+  grpc_slice_buffer_append_copied(&buf, data, 3);
+  grpc_slice_buffer_append_copied(&buf, data + 3, 4);
+  GPR_ASSERT(buf.count == 1);
+  GPR_ASSERT(buf.length == 7);
+  GPR_ASSERT(buf.slices[0].refcount == nullptr);
+
+  /* a large append tops off the inlined tail, then takes one slice */
+  grpc_slice_buffer_append_copied(&buf, data + 7, 29);
+  GPR_ASSERT(buf.count == 2);
+  GPR_ASSERT(buf.length == 36);
+  GPR_ASSERT(GRPC_SLICE_LENGTH(buf.slices[0]) == GRPC_SLICE_INLINED_SIZE);
+
+  /* refcounted tail slices are never appended to */
+  grpc_slice_buffer_add(&buf, grpc_slice_from_copied_string(data));
+  grpc_slice_buffer_append_copied(&buf, data, 1);
+  GPR_ASSERT(buf.count == 4);
+  GPR_ASSERT(buf.length == 73);
+
+  char out[73];
+  grpc_slice_buffer_move_first_into_buffer(&buf, sizeof(out), out);
+  GPR_ASSERT(memcmp(out, data, 36) == 0);
+  GPR_ASSERT(memcmp(out + 36, data, 36) == 0);
+  GPR_ASSERT(out[72] == '0');
+  grpc_slice_buffer_destroy(&buf);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -154,6 +188,7 @@ int main(int argc, char** argv) {
   test_slice_buffer_add();
   test_slice_buffer_move_first();
   test_slice_buffer_first();
+  test_slice_buffer_append_copied();
 
   grpc_shutdown();
   return 0;
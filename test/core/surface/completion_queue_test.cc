@@ -501,5 +501,11 @@ int main(int argc, char** argv) {
   test_cq_tls_cache_empty();
   test_callback();
   grpc_shutdown();
+
+  /* Again with the functors run on the callback thread pool */
+  GPR_GLOBAL_CONFIG_SET(grpc_callback_cq_threads, 2);
+  grpc_init();
+  test_callback();
+  grpc_shutdown();
   return 0;
 }
@@ -98,6 +98,22 @@ TEST(BdpEstimatorTest, GetEstimate3Samples) {
   est.EstimateBdp();
 }
 
+TEST(BdpEstimatorTest, RttEstimateIsSmoothed) {
+  BdpEstimator est("test");
+  EXPECT_EQ(est.EstimateRtt(), 0);
+  grpc_core::ExecCtx exec_ctx;
+  est.SchedulePing();
+  est.StartPing();
+  g_clock += 8;
+  est.CompletePing();
+  EXPECT_DOUBLE_EQ(est.EstimateRtt(), 8);
+  est.SchedulePing();
+  est.StartPing();
+  g_clock += 16;
+  est.CompletePing();
+  EXPECT_DOUBLE_EQ(est.EstimateRtt(), 9);
+}
+
 namespace {
 int64_t NextPow2(int64_t v) {
   v--;
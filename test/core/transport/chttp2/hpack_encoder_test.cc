@@ -394,6 +394,35 @@ static void test_interned_key_indexed() {
   }
 }
 
+static void test_cached_header_blocks() {
+  g_compressor.cache_header_blocks = true;
+  verify_params params = {
+      false,
+      false,
+      false,
+  };
+  /* a literal that adds to the table is never cached */
+  verify(params, "000005 0104 deadbeef 40 0161 0161", 1, "a", "a");
+  GPR_ASSERT(!g_compressor.cached_block.valid);
+  verify(params, "000001 0104 deadbeef be", 1, "a", "a");
+  GPR_ASSERT(g_compressor.cached_block.valid);
+  verify(params, "000001 0104 deadbeef be", 1, "a", "a");
+  GPR_ASSERT(g_compressor.cached_block.valid);
+  /* adding b: c shifts the dynamic indices, which must drop the cache */
+  verify(params, "000006 0104 deadbeef be 40 0162 0163", 2, "a", "a", "b", "c");
+  GPR_ASSERT(!g_compressor.cached_block.valid);
+  verify(params, "000002 0104 deadbeef bf be", 2, "a", "a", "b", "c");
+  verify(params, "000002 0104 deadbeef bf be", 2, "a", "a", "b", "c");
+  GPR_ASSERT(g_compressor.cached_block.valid);
+  /* a different set of elements misses the cache and replaces it */
+  verify(params, "000001 0104 deadbeef be", 1, "b", "c");
+  verify(params, "000002 0104 deadbeef bf be", 2, "a", "a", "b", "c");
+  grpc_chttp2_hpack_compressor_set_max_table_size(&g_compressor, 1024);
+  GPR_ASSERT(!g_compressor.cached_block.valid);
+  verify(params, "000004 0104 deadbeef 3fe107 bf be", 2, "a", "a", "b", "c");
+  verify(params, "000002 0104 deadbeef bf be", 2, "a", "a", "b", "c");
+}
+
 static void run_test(void (*test)(), const char* name) {
   gpr_log(GPR_INFO, "RUN TEST: %s", name);
   grpc_core::ExecCtx exec_ctx;
@@ -412,6 +441,7 @@ int main(int argc, char** argv) {
   TEST(test_encode_header_size);
   TEST(test_interned_key_indexed);
   TEST(test_continuation_headers);
+  TEST(test_cached_header_blocks);
   grpc_shutdown();
   for (i = 0; i < num_to_delete; i++) {
     gpr_free(to_delete[i]);
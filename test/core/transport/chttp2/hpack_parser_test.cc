@@ -210,6 +210,20 @@ static void test_vectors(grpc_slice_split_mode mode) {
               "set-cookie",
               "foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1", NULL);
   grpc_chttp2_hpack_parser_destroy(&parser);
+
+  grpc_chttp2_hpack_parser_init(&parser);
+  /* true-binary and base64 encoded -bin values */
+  test_vector(&parser, mode,
+              "0005 782d 6269 6e1c 0061 6263 6465 6667"
+              "6869 6a6b 6c6d 6e6f 7071 7273 7475 7677"
+              "7879 7a30",
+              "x-bin", "abcdefghijklmnopqrstuvwxyz0", NULL);
+  test_vector(&parser, mode,
+              "0005 782d 6269 6e24 5957 4a6a 5a47 566d"
+              "5a32 6870 616d 7473 6257 3576 6348 4679"
+              "6333 5231 646e 6434 6558 6f77",
+              "x-bin", "abcdefghijklmnopqrstuvwxyz0", NULL);
+  grpc_chttp2_hpack_parser_destroy(&parser);
 }
 
 int main(int argc, char** argv) {
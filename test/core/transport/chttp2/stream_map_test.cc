@@ -142,7 +142,7 @@ static void test_delete_evens_incremental(uint32_t n) {
 }
 
 /* add a bunch of keys, delete old ones after some time, ensure the
-   backing array does not grow */
+   backing table does not grow */
 static void test_periodic_compaction(uint32_t n) {
   grpc_chttp2_stream_map map;
   uint32_t i;
@@ -165,6 +165,31 @@ static void test_periodic_compaction(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
+/* for_each callback that deletes the entry it is called for */
+static void delete_on_visit(void* user_data, uint32_t stream_id, void* ptr) {
+  grpc_chttp2_stream_map* map = static_cast<grpc_chttp2_stream_map*>(user_data);
+  GPR_ASSERT(ptr == grpc_chttp2_stream_map_delete(map, stream_id));
+}
+
+/* delete every entry from inside for_each, and make sure every entry was
+   visited exactly once */
+static void test_delete_during_for_each(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+
+  LOG_TEST("test_delete_during_for_each");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (i = 1; i <= n; i++) {
+    grpc_chttp2_stream_map_add(&map, i, (void*)static_cast<uintptr_t>(i));
+  }
+  grpc_chttp2_stream_map_for_each(&map, delete_on_visit, &map);
+  GPR_ASSERT(0 == grpc_chttp2_stream_map_size(&map));
+  GPR_ASSERT(nullptr == grpc_chttp2_stream_map_rand(&map));
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
 int main(int argc, char** argv) {
   uint32_t n = 1;
   uint32_t prev = 1;
@@ -180,6 +205,7 @@ int main(int argc, char** argv) {
     test_delete_evens_sweep(n);
     test_delete_evens_incremental(n);
     test_periodic_compaction(n);
+    test_delete_during_for_each(n);
 
     tmp = n;
     n += prev;
@@ -553,6 +553,29 @@ TEST_F(ClientLbEnd2endTest, PickFirstSelectsReadyAtStartup) {
   EXPECT_TRUE(WaitForChannelReady(channel2.get(), 1 /* timeout_seconds */));
 }
 
+TEST_F(ClientLbEnd2endTest, PickFirstConnectionAttemptDelay) {
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_PICK_FIRST_CONNECTION_ATTEMPT_DELAY_MS, 100);
+  // Create 3 servers, but start only the last one.
+  std::vector<int> ports = {grpc_pick_unused_port_or_die(),
+                            grpc_pick_unused_port_or_die(),
+                            grpc_pick_unused_port_or_die()};
+  CreateServers(3, ports);
+  StartServer(2);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(ports);
+  WaitForServer(stub, 2, DEBUG_LOCATION);
+  for (size_t i = 0; i < 10; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  // All requests went to the only server that is up.
+  EXPECT_EQ(0, servers_[0]->service_.request_count());
+  EXPECT_EQ(0, servers_[1]->service_.request_count());
+  EXPECT_EQ(10, servers_[2]->service_.request_count());
+}
+
 TEST_F(ClientLbEnd2endTest, PickFirstBackOffInitialReconnect) {
   ChannelArguments args;
   constexpr int kInitialBackOffMs = 100;
@@ -25,6 +25,8 @@
 #include <memory>
 #include <sstream>
 
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/ext/transport/chttp2/transport/incoming_metadata.h"
@@ -427,6 +429,48 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 
 }  // namespace hpack_encoder_fixtures
 
+////////////////////////////////////////////////////////////////////////////////
+// Binary metadata encoding
+//
+
+static grpc_slice MakeBinaryValue(size_t length) {
+  grpc_slice s = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(s);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>(i * 131 + 7);
+  }
+  return s;
+}
+
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice input = MakeBinaryValue(state.range(0));
+  for (auto _ : state) {
+    grpc_slice_unref_internal(
+        grpc_chttp2_base64_encode_and_huffman_compress(input));
+  }
+  grpc_slice_unref_internal(input);
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)->Range(16, 16384);
+
+static void BM_Base64Decode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice value = MakeBinaryValue(state.range(0));
+  grpc_slice input = grpc_chttp2_base64_encode(value);
+  for (auto _ : state) {
+    grpc_slice_unref_internal(grpc_chttp2_base64_decode(input));
+  }
+  grpc_slice_unref_internal(input);
+  grpc_slice_unref_internal(value);
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Decode)->Range(16, 16384);
+
 ////////////////////////////////////////////////////////////////////////////////
 // HPACK parser
 //
@@ -865,6 +909,44 @@ static grpc_error* OnHeaderTimeout(void* /*user_data*/, grpc_mdelem md) {
   return GRPC_ERROR_NONE;
 }
 
+// Literal headers (never added to the table) with huffman coded names and
+// values, shaped like the long paths, bearer tokens and tracing headers seen
+// by proxies: every iteration huffman decodes all of them.
+class HuffmanEncodedHeaders {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    static const char* kHeaders[][2] = {
+        {"x-original-path",
+         "/google.example.library.v1.LibraryService/ListBooksByAuthorAndShelf"},
+        {"authorization",
+         "Bearer eyJhbGciOiJSUzI1NiIsImtpZCI6IjRmMWUyYTNiNGM1ZDZlN2YifQ."
+         "eyJpc3MiOiJhY2NvdW50cy5leGFtcGxlLmNvbSIsInN1YiI6IjEyMzQ1NiJ9."
+         "c2lnbmF0dXJl"},
+        {"traceparent",
+         "00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01"},
+        {"x-request-id", "f81d4fae-7dec-11d0-a765-00a0c91e6bf6"},
+        {"user-agent", "grpc-c++/1.32.0-dev (linux; chttp2; x86_64)"},
+    };
+    std::vector<uint8_t> bytes;
+    auto add_string = [&bytes](const char* str) {
+      grpc_slice huff =
+          grpc_chttp2_huffman_compress(grpc_slice_from_static_string(str));
+      GPR_ASSERT(GRPC_SLICE_LENGTH(huff) < 0x7f);
+      bytes.push_back(0x80 | static_cast<uint8_t>(GRPC_SLICE_LENGTH(huff)));
+      bytes.insert(bytes.end(), GRPC_SLICE_START_PTR(huff),
+                   GRPC_SLICE_END_PTR(huff));
+      grpc_slice_unref(huff);
+    };
+    for (const auto& header : kHeaders) {
+      bytes.push_back(0x10);  // literal header field never indexed, new name
+      add_string(header[0]);
+      add_string(header[1]);
+    }
+    return {MakeSlice(bytes)};
+  }
+};
+
 // Send the same deadline repeatedly
 class SameDeadline {
  public:
@@ -927,6 +1009,8 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    MoreRepresentativeClientInitialMetadata, OnInitialHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata, OnInitialHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, HuffmanEncodedHeaders,
+                   UnrefHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline, OnHeaderTimeout);
 
 }  // namespace hpack_parser_fixtures
@@ -0,0 +1,98 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Microbenchmarks around the CHTTP2 stream map */
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/ext/transport/chttp2/transport/stream_map.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+static void* ValueFor(uint32_t key) {
+  return reinterpret_cast<void*>(static_cast<uintptr_t>(key));
+}
+
+// Lookup of a live stream with range(0) concurrently open streams: this is
+// what parsing does for every incoming frame.
+static void BM_StreamMapFind(benchmark::State& state) {
+  const uint32_t live = static_cast<uint32_t>(state.range(0));
+  grpc_chttp2_stream_map map;
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (uint32_t i = 0; i < live; i++) {
+    grpc_chttp2_stream_map_add(&map, 2 * i + 1, ValueFor(2 * i + 1));
+  }
+  uint32_t i = 0;
+  for (auto _ : state) {
+    const uint32_t key = 2 * i + 1;
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_find(&map, key));
+    if (++i == live) i = 0;
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+BENCHMARK(BM_StreamMapFind)->Range(1, 64 * 1024);
+
+// Stream churn: range(0) streams open, each iteration opens a new stream and
+// closes the oldest one.
+static void BM_StreamMapChurn(benchmark::State& state) {
+  const uint32_t live = static_cast<uint32_t>(state.range(0));
+  grpc_chttp2_stream_map map;
+  grpc_chttp2_stream_map_init(&map, 8);
+  uint32_t next_id = 1;
+  for (uint32_t i = 0; i < live; i++) {
+    grpc_chttp2_stream_map_add(&map, next_id, ValueFor(next_id));
+    next_id += 2;
+  }
+  uint32_t oldest = 1;
+  for (auto _ : state) {
+    grpc_chttp2_stream_map_add(&map, next_id, ValueFor(next_id));
+    next_id += 2;
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_delete(&map, oldest));
+    oldest += 2;
+    // stream ids are 31 bits: start over before running out
+    if (next_id > (1u << 30)) {
+      state.PauseTiming();
+      grpc_chttp2_stream_map_destroy(&map);
+      grpc_chttp2_stream_map_init(&map, 8);
+      next_id = 1;
+      for (uint32_t i = 0; i < live; i++) {
+        grpc_chttp2_stream_map_add(&map, next_id, ValueFor(next_id));
+        next_id += 2;
+      }
+      oldest = 1;
+      state.ResumeTiming();
+    }
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+BENCHMARK(BM_StreamMapChurn)->Range(1, 64 * 1024);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -682,6 +682,29 @@ static void BM_TransportStreamRecv(benchmark::State& state) {
 }
 BENCHMARK(BM_TransportStreamRecv)->Range(0, 128 * 1024 * 1024);
 
+// Each iteration feeds the transport a SETTINGS frame and a PING frame, so
+// that it has to answer with a SETTINGS ACK and a PING ACK. The allocs/iter
+// counter shows what answering control frames costs per exchange.
+static void BM_TransportControlFrameAcks(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  Fixture f(grpc::ChannelArguments(), true);
+  grpc_slice incoming = SLICE_FROM_BUFFER(
+      // SETTINGS, no parameters
+      "\x00\x00\x00\x04\x00\x00\x00\x00\x00"
+      // PING, opaque data 0x0102030405060708
+      "\x00\x00\x08\x06\x00\x00\x00\x00\x00"
+      "\x01\x02\x03\x04\x05\x06\x07\x08");
+  while (state.KeepRunning()) {
+    f.PushInput(grpc_slice_ref(incoming));
+    f.FlushExecCtx();
+  }
+  grpc_slice_unref(incoming);
+  f.FlushExecCtx();
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_TransportControlFrameAcks);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
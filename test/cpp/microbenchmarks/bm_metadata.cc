@@ -18,6 +18,9 @@
 
 /* Test out various metadata handling primitives */
 
+#include <string>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
@@ -69,6 +72,33 @@ static void BM_SliceReIntern(benchmark::State& state) {
 }
 BENCHMARK(BM_SliceReIntern);
 
+static void BM_SliceInternContended(benchmark::State& state) {
+  TrackCounters track_counters;
+  // Every thread interns the same handful of strings, which stay in the
+  // intern table for the whole run, so only lookups contend.
+  constexpr size_t kNumStrings = 16;
+  std::vector<std::string> strings;
+  std::vector<grpc_slice> held;
+  for (size_t i = 0; i < kNumStrings; i++) {
+    strings.push_back("x-custom-key-" + std::to_string(i));
+    held.push_back(grpc_slice_intern(
+        grpc_slice_from_static_string(strings.back().c_str())));
+  }
+  std::vector<grpc_core::ExternallyManagedSlice> slices;
+  for (const std::string& s : strings) {
+    slices.emplace_back(s.c_str());
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_core::ManagedMemorySlice(&slices[i++ % kNumStrings]));
+  }
+  for (grpc_slice& s : held) {
+    grpc_slice_unref(s);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceInternContended)->ThreadRange(1, 64);
+
 static void BM_SliceInternStaticMetadata(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
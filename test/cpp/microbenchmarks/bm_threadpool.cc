@@ -311,6 +311,42 @@ static void BM_SpikyLoad(benchmark::State& state) {
 }
 BENCHMARK(BM_SpikyLoad)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
 
+// Contention on the closure queue alone: every benchmark thread puts an
+// element and takes one back out, so threads never block for long but all of
+// them hit the queue at once.
+static grpc_core::MPMCQueueInterface* g_contended_queue;
+
+static void MPMCQueuePutGet(benchmark::State& state) {
+  int item;
+  for (auto _ : state) {
+    g_contended_queue->Put(&item);
+    benchmark::DoNotOptimize(g_contended_queue->Get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_InfLenFIFOQueuePutGet(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    g_contended_queue = new grpc_core::InfLenFIFOQueue();
+  }
+  MPMCQueuePutGet(state);
+  if (state.thread_index == 0) {
+    delete g_contended_queue;
+  }
+}
+BENCHMARK(BM_InfLenFIFOQueuePutGet)->Threads(8)->Threads(32)->Threads(64);
+
+static void BM_BoundedMPMCQueuePutGet(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    g_contended_queue = new grpc_core::BoundedMPMCQueue(1024);
+  }
+  MPMCQueuePutGet(state);
+  if (state.thread_index == 0) {
+    delete g_contended_queue;
+  }
+}
+BENCHMARK(BM_BoundedMPMCQueuePutGet)->Threads(8)->Threads(32)->Threads(64);
+
 }  // namespace testing
 }  // namespace grpc
 